@@ -30,6 +30,7 @@
 #define _SOPLEX_H_
 
 #include <string.h>
+#include <vector>
 
 #include "soplex/spxgithash.h"
 #include "soplex/spxdefines.h"
@@ -66,12 +67,15 @@
 #include "soplex/spxharrisrt.h"
 #include "soplex/spxfastrt.h"
 #include "soplex/spxboundflippingrt.h"
+#include "soplex/spxpackedrt.h"
 
 #include "soplex/solbase.h"
 #include "soplex/sol.h"
 
 #include "soplex/spxlpbase.h"
 
+#include "soplex/spxbarrier.h"
+
 #include "soplex/spxpapilo.h"
 
 #ifdef SOPLEX_WITH_GMP
@@ -336,6 +340,11 @@ public:
    /// adds multiple columns
    void addColsReal(const LPColSetBase<R>& lpcolset);
 
+   /// adds multiple columns generated in a pricing round; the columns are appended to the loaded LP, scaled with the
+   /// existing row scaling factors, and the next solve continues from the current basis with the primal simplex
+   /// without presolving or rescaling the LP
+   void addColsWarmStartReal(const LPColSetBase<R>& lpcolset);
+
    /// replaces row \p i with \p lprow
    void changeRowReal(int i, const LPRowBase<R>& lprow);
 
@@ -387,6 +396,10 @@ public:
    /// changes matrix entry in row \p i and column \p j to \p val
    void changeElementReal(int i, int j, const R& val);
 
+   /// changes the matrix entries in rows \p rows[k] and columns \p cols[k] to \p vals[k] for k = 0, ..., \p n - 1,
+   /// where a later change of the same entry overrides an earlier one
+   void changeElementsReal(int n, const int rows[], const int cols[], const R vals[]);
+
    /// removes row \p i
    void removeRowReal(int i);
 
@@ -638,6 +651,83 @@ public:
    /// is Farkas proof of infeasibility available?
    bool hasDualFarkas() const;
 
+   /// sides and bounds of one scenario of the real LP and its results after calling optimizeScenariosReal(); vectors
+   /// of dimension zero are taken from the real LP
+   struct Scenario
+   {
+      VectorBase<R> lhs;                          ///< left-hand sides of the rows
+      VectorBase<R> rhs;                          ///< right-hand sides of the rows
+      VectorBase<R> lower;                        ///< lower bounds of the columns
+      VectorBase<R> upper;                        ///< upper bounds of the columns
+
+      typename SPxSolverBase<R>::Status status;   ///< solver status of the scenario
+      R objValue;                                 ///< objective value if the scenario has been solved to optimality
+      VectorBase<R> primal;                       ///< primal solution if the scenario has been solved to optimality
+      VectorBase<R> dual;                         ///< dual solution if the scenario has been solved to optimality
+      int iterations;                             ///< number of simplex iterations for the scenario
+      int warmStart;                              ///< scenario whose basis was used as starting basis, or -1 if the
+      ///< basis of the real LP was used
+
+      Scenario()
+         : status(SPxSolverBase<R>::UNKNOWN)
+         , objValue(0)
+         , iterations(0)
+         , warmStart(-1)
+      {}
+   };
+
+   /// solves the real LP for each scenario of sides and bounds in \p scenarios concurrently, starting each scenario
+   /// from the basis of a similar scenario; the real LP, its basis and its solution remain unchanged; returns false if
+   /// a scenario does not match the dimension of the real LP
+   bool optimizeScenariosReal(std::vector<Scenario>& scenarios, volatile bool* interrupt = NULL);
+
+   /// features of the real LP on which the automatic choice of representation, algorithm, pricer and ratio tester is
+   /// based; the starting point sets every column to its finite bound closest to zero, or to zero if it is free
+   struct LPFeatures
+   {
+      int nRows;                  ///< number of rows
+      int nCols;                  ///< number of columns
+      int nNonzeros;              ///< number of nonzeros
+      Real density;               ///< fraction of nonzero entries of the constraint matrix
+      Real aspectRatio;           ///< (nRows + 1) / (nCols + 1), compared with REPRESENTATION_SWITCH
+      Real boxedCols;             ///< fraction of columns with finite lower and upper bound
+      Real freeCols;              ///< fraction of free columns
+      Real equalityRows;          ///< fraction of equality rows
+      Real rangedRows;            ///< fraction of ranged rows
+      Real infeasibleRows;        ///< fraction of rows violated at the starting point
+      Real degenerateRows;        ///< fraction of rows with activity at a side at the starting point
+
+      LPFeatures()
+         : nRows(0)
+         , nCols(0)
+         , nNonzeros(0)
+         , density(0)
+         , aspectRatio(1)
+         , boxedCols(0)
+         , freeCols(0)
+         , equalityRows(0)
+         , rangedRows(0)
+         , infeasibleRows(0)
+         , degenerateRows(0)
+      {}
+   };
+
+   /// computes the features of the real LP
+   void getLPFeaturesReal(LPFeatures& features) const;
+
+   /// learns the thresholds AUTOSELECT_PRIMAL, AUTOSELECT_STEEP, AUTOSELECT_BOUNDFLIP and REPRESENTATION_SWITCH of the
+   /// automatic selection from timings of the LPs in \p filenames: every LP is solved with both choices of every
+   /// decision, the others taken from the current parameters, and each threshold is set such that the total solving
+   /// time of its decision is minimal; returns false if no LP could be read
+   bool calibrateAutoSelect(const std::vector<std::string>& filenames);
+
+   /// searches pricer, ratio tester, scaler, simplifier, representation and refactorization parameters for the
+   /// configuration with the smallest total solving time on the LPs in \p filenames, running THREADS solves in parallel
+   /// and stopping after \p timeBudget seconds; the best configuration found becomes the current parameter setting and
+   /// \p speedup returns the total time of the initial configuration divided by that of the best; returns false if no
+   /// LP could be read
+   bool tuneSettings(const std::vector<std::string>& filenames, Real timeBudget, Real& speedup);
+
    /// sets the status to OPTIMAL in case the LP has been solved with unscaled violations
    bool ignoreUnscaledViolations()
    {
@@ -682,6 +772,16 @@ public:
    bool getRedCostReal(R* vector, int dim); /* For SCIP compatibility */
    bool getRedCostRational(VectorRational& vector);
 
+   /// computes the reduced costs of the candidate columns \p lpcolset with respect to the current dual solution;
+   /// returns true on success
+   bool getRedCostCandidatesReal(const LPColSetBase<R>& lpcolset, VectorBase<R>& redcost);
+
+   /// computes the ranges [objLower, objUpper] of the objective coefficients and [sideLower, sideUpper] of the active
+   /// sides of the rows in which the current optimal basis stays optimal; for basic rows, the range of the right-hand
+   /// side is given if it is finite and that of the left-hand side otherwise; returns true on success
+   bool getRangingReal(VectorBase<R>& objLower, VectorBase<R>& objUpper, VectorBase<R>& sideLower,
+                       VectorBase<R>& sideUpper);
+
    /// gets the Farkas proof if available; returns true on success
    bool getDualFarkas(VectorBase<R>& vector);
    bool getDualFarkasReal(R* vector, int dim);
@@ -782,6 +882,7 @@ public:
     *  type = 0: max/min ratio
     *  type = 1: trace of U (sum of diagonal elements)
     *  type = 2: determinant (product of diagonal elements)
+    *  type = 3: estimated 1-norm condition number (block 1-norm estimator of Higham and Tisseur)
     */
    bool getBasisMetric(R& metric, int type = 0);
 
@@ -917,6 +1018,23 @@ public:
    /// default names are assumed; returns true on success
    bool readBasisFile(const char* filename, const NameSet* rowNames = 0, const NameSet* colNames = 0);
 
+   /// writes checkpoints of the basis and the dual norms to \p filename during floating-point solves, every
+   /// CHECKPOINT_ITER iterations and every CHECKPOINT_TIME seconds; a null \p filename disables checkpointing
+   void setCheckpointFile(const char* filename);
+
+   /// reads a checkpoint written during an earlier solve of the same LP with the same settings, from which the next
+   /// floating-point solve is resumed; returns true on success
+   bool readCheckpoint(const char* filename);
+
+   /// reads a binary warm-start file written by writeWarmStartFile() and sets the starting basis, the dual norms and
+   /// the scaling stored in it; no names are resolved, so the LP must have the same rows and columns in the same
+   /// order; returns true on success
+   bool readWarmStartFile(const char* filename);
+
+   /// writes the current basis, the dual norms if available and the scaling exponents of the persistent scaling to a
+   /// binary warm-start file; returns true on success
+   bool writeWarmStartFile(const char* filename) const;
+
    /// writes basis information to \p filename; if \p rowNames and \p colNames are \c NULL, default names are used;
    /// returns true on success
    bool writeBasisFile(const char* filename, const NameSet* rowNames = 0, const NameSet* colNames = 0,
@@ -1017,8 +1135,14 @@ public:
       // enable presolver DominatedCols in PaPILO?
       SIMPLIFIER_DOMINATEDCOLS = 24,
 
+      /// solve the real LP with lazily generated rows?
+      LAZYROWS = 25,
+
+      /// choose representation, algorithm, pricer and ratio tester of the floating-point solve from features of the LP?
+      AUTOSELECT = 26,
+
       /// number of boolean parameters
-      BOOLPARAM_COUNT = 25
+      BOOLPARAM_COUNT = 27
    } BoolParam;
 
    /// integer parameters
@@ -1114,8 +1238,26 @@ public:
       /// type of timer for statistics
       STATTIMER = 29,
 
+      /// number of threads used for parallelized parts of the solving process, e.g., presolving with PaPILO
+      THREADS = 30,
+
+      /// maximum number of candidates tried during solution polishing (-1: no limit)
+      POLISHING_LIMIT = 31,
+
+      /// maximum number of rows added in one round of lazy row generation
+      LAZYROWS_BATCH = 32,
+
+      /// number of consecutive rounds with basic slack after which a lazy row is dropped again (-1: never)
+      LAZYROWS_AGE = 33,
+
+      /// maximum number of nonzeros moved by one incremental compaction step of the LP matrix memory (0: compact at once)
+      MEMPACK_SLICE = 34,
+
+      /// number of iterations between two checkpoints of a floating-point solve (0: no iteration-based checkpoints)
+      CHECKPOINT_ITER = 35,
+
       /// number of integer parameters
-      INTPARAM_COUNT = 30
+      INTPARAM_COUNT = 36
    } IntParam;
 
    /// values for parameter OBJSENSE
@@ -1148,7 +1290,10 @@ public:
       ALGORITHM_PRIMAL = 0,
 
       /// dual simplex algorithm, i.e., leaving for column and entering for row representation
-      ALGORITHM_DUAL = 1
+      ALGORITHM_DUAL = 1,
+
+      /// interior point method with crossover, followed by the primal simplex algorithm
+      ALGORITHM_BARRIER = 2
    };
 
    /// values for parameter FACTOR_UPDATE_TYPE
@@ -1275,7 +1420,10 @@ public:
       RATIOTESTER_FAST = 2,
 
       /// bound flipping ratio test for long steps in the dual simplex
-      RATIOTESTER_BOUNDFLIPPING = 3
+      RATIOTESTER_BOUNDFLIPPING = 3,
+
+      /// standard Harris ratio test on packed candidate arrays
+      RATIOTESTER_PACKED = 4
    };
 
    /// values for parameter SYNCMODE
@@ -1447,8 +1595,21 @@ public:
       /// minimal modification threshold to apply presolve reductions
       SIMPLIFIER_MODIFYROWFAC = 25,
 
+      /// number of seconds between two checkpoints of a floating-point solve (0: no time-based checkpoints)
+      CHECKPOINT_TIME = 26,
+
+      /// maximum fraction of rows violated at the starting point for which the automatic selection uses the primal simplex
+      AUTOSELECT_PRIMAL = 27,
+
+      /// fraction of rows with activity at a side at the starting point above which the automatic selection uses
+      /// steepest edge instead of devex pricing
+      AUTOSELECT_STEEP = 28,
+
+      /// fraction of boxed columns above which the automatic selection uses the bound flipping ratio test
+      AUTOSELECT_BOUNDFLIP = 29,
+
       /// number of real parameters
-      REALPARAM_COUNT = 26
+      REALPARAM_COUNT = 30
    } RealParam;
 
 #ifdef SOPLEX_WITH_RATIONALPARAM
@@ -1704,6 +1865,7 @@ private:
    SPxHarrisRT<R> _ratiotesterHarris;
    SPxFastRT<R> _ratiotesterFast;
    SPxBoundFlippingRT<R> _ratiotesterBoundFlipping;
+   SPxPackedRT<R> _ratiotesterPacked;
 
    SPxLPBase<R>*
    _realLP; // the real LP is also used as the original LP for the decomposition dual simplex
@@ -1716,6 +1878,10 @@ private:
    // are performed on the original LP.
    bool _isRealLPScaled;
    bool _applyPolishing;
+   bool _colGenWarmStart; // true indicates that columns have been generated since the last solve, hence the next
+   // solve continues from the current basis with the primal simplex
+   std::vector<int> _warmStartRowScaleExp; // row scaling exponents of the last warm-start file, applied by the next solve
+   std::vector<int> _warmStartColScaleExp; // column scaling exponents of the last warm-start file
 
    VectorBase<R> _manualLower;
    VectorBase<R> _manualUpper;
@@ -1731,6 +1897,9 @@ private:
    ///@{
 
    SPxLPRational* _rationalLP;
+   std::vector<uint64_t> _syncRowSideHash;   ///< hashes of row sides and row objectives of the real LP at the last sync
+   std::vector<uint64_t> _syncRowVecHash;    ///< hashes of the row vectors of the real LP at the last sync
+   std::vector<uint64_t> _syncColHash;       ///< hashes of bounds and objective of the real LP columns at the last sync
    SLUFactorRational _rationalLUSolver;
    DataArray<int> _rationalLUSolverBind;
 
@@ -2070,6 +2239,9 @@ private:
    /// changes matrix entry in row \p i and column \p j to \p val and adjusts basis
    void _changeElementReal(int i, int j, const R& val);
 
+   /// changes the matrix entries in rows \p rows[k] and columns \p cols[k] to \p vals[k] and adjusts basis
+   void _changeElementsReal(int n, const int rows[], const int cols[], const R vals[]);
+
    /// removes row \p i and adjusts basis
    void _removeRowReal(int i);
 
@@ -2102,6 +2274,33 @@ private:
    /// buffer memory
    void _removeColRangeReal(int start, int end, int perm[]);
 
+   /// computes the basis that remains after removing all rows with an index \p i such that \p perm[i] < 0; for every
+   /// removed row with nonbasic slack, one basic variable becomes nonbasic; returns false if no regular basis was found
+   bool _basisAfterRemovingRows(const int perm[], DataArray< typename SPxSolverBase<R>::VarStatus >& rowStatus,
+                                DataArray< typename SPxSolverBase<R>::VarStatus >& colStatus);
+
+   /// computes the basis that remains after removing all columns with an index \p i such that \p perm[i] < 0; for every
+   /// removed basic column, the slack of a row with nonbasic slack becomes basic; returns false if no regular basis was
+   /// found
+   bool _basisAfterRemovingCols(const int perm[], DataArray< typename SPxSolverBase<R>::VarStatus >& rowStatus,
+                                DataArray< typename SPxSolverBase<R>::VarStatus >& colStatus);
+
+   /// factorizes the basis matrix of \p lp given by \p rowStatus and \p colStatus in the formulation A x - s = 0; returns
+   /// false if the basis has not exactly one basic variable per row or its matrix is singular
+   bool _factorizeBasisMatrix(const SPxLPBase<R>& lp, const typename SPxSolverBase<R>::VarStatus rowStatus[],
+                              const typename SPxSolverBase<R>::VarStatus colStatus[], SLUFactor<R>& factor,
+                              std::vector<int>& basicVar);
+
+   /// selects one index for each of the \p nvecs vectors given by \p solve(t, vec) by calling \p select(t, vec, nonzeros)
+   /// such that the matrix of these vectors restricted to the selected indices is regular; returns false if \p select
+   /// did not find an index
+   template <class F, class G>
+   bool _selectRepairPivots(int nvecs, int dim, const F& solve, const G& select, std::vector<int>& pivots);
+
+   /// returns the nonbasic status of a variable with bounds \p lower and \p upper that leaves the basis at value \p value,
+   /// which is only used if \p hasValue is true
+   typename SPxSolverBase<R>::VarStatus _repairedVarStatus(R value, bool hasValue, R lower, R upper) const;
+
    /// invalidates solution
    void _invalidateSolution();
 
@@ -2120,6 +2319,10 @@ private:
    /// call floating-point solver and update statistics on iterations etc.
    void _solveRealLPAndRecordStatistics(volatile bool* interrupt = NULL);
 
+   /// solves the real LP by the interior point method and loads the basis from crossover into the solver; returns
+   /// false if the interior point method did not converge
+   bool _solveBarrierReal(volatile bool* interrupt);
+
    /// reads real LP in LP or MPS format from file and returns true on success; gets row names, column names, and
    /// integer variables if desired
    bool _readFileReal(const char* filename, NameSet* rowNames = 0, NameSet* colNames = 0,
@@ -2145,6 +2348,15 @@ private:
    /// synchronizes rational LP with real LP, i.e., copies real LP to rational LP, without looking at the sync mode
    void _syncLPRational(bool time = true);
 
+   /// computes hashes of the rows and columns of the real LP which detect changes since the last sync
+   void _hashLPReal(std::vector<uint64_t>& rowSide, std::vector<uint64_t>& rowVec,
+                    std::vector<uint64_t>& col) const;
+
+   /// converts only the rows and columns of the real LP whose hashes changed since the last sync; returns false if
+   /// the rational LP must be copied completely
+   bool _updateLPRational(const std::vector<uint64_t>& rowSide, const std::vector<uint64_t>& rowVec,
+                          const std::vector<uint64_t>& col);
+
    /// synchronizes rational solution with real solution, i.e., copies (rounded) rational solution to real solution
    void _syncRealSolution();
 
@@ -2431,6 +2643,13 @@ private:
    /// solves real LP with/without preprocessing
    void _preprocessAndSolveReal(bool applyPreprocessing, volatile bool* interrupt = NULL);
 
+   /// solves real LP on a set of active rows, adding violated rows lazily, and finally resolves the full LP
+   void _solveRealLazyRows(volatile bool* interrupt = NULL);
+
+   /// collects the rows of the real LP not active in the solver that are violated by \p x or block the ray \p x
+   void _findLazyRowViolations(const VectorBase<R>& x, bool isRay, const DataArray<int>& activeRows,
+                               std::vector<RowViolation>& violations);
+
    /// loads original problem into solver and solves again after it has been solved to optimality with preprocessing
    void _resolveWithoutPreprocessing(typename SPxSimplifier<R>::Result simplificationStatus);
 
@@ -2485,6 +2704,10 @@ private:
    void _getZeroDualMultiplierIndices(VectorBase<R> feasVector, int* nonposind, int* colsforremoval,
                                       int* nnonposind, bool& stop);
 
+   /// solves y B = A_{i,.} with the basis of the reduced problem for the given rows, possibly in parallel
+   template <class F>
+   void _solveDecompRows(const int* rows, int nrows, const F& func);
+
    /// retrieves the compatible columns from the constraint matrix
    void _getCompatibleColumns(VectorBase<R> feasVector, int* nonposind, int* compatind,
                               int* rowsforremoval, int* colsforremoval,
@@ -2511,9 +2734,10 @@ private:
                                 typename SPxSimplifier<R>::Result result);
 
    /// update the reduced problem with additional columns and rows
-   void _updateDecompReducedProblem(R objVal, VectorBase<R> dualVector, VectorBase<R> redcostVector,
-                                    VectorBase<R> compPrimalVector,
-                                    VectorBase<R> compDualVector);
+   void _updateDecompReducedProblem(R objVal, const VectorBase<R>& dualVector,
+                                    const VectorBase<R>& redcostVector,
+                                    const VectorBase<R>& compPrimalVector,
+                                    const VectorBase<R>& compDualVector);
 
    /// update the reduced problem with additional columns and rows based upon the violated original bounds and rows
    void _updateDecompReducedProblemViol(bool allrows);
@@ -2604,6 +2828,49 @@ private:
    void getOriginalProblemBasisColStatus(int& nNonBasicCols);
 
    ///@}
+
+   ///@name Private methods for solving several scenarios implemented in solvescenarios.hpp
+   ///@{
+
+   /// returns the nonbasic status \p status adapted to the bounds \p lower and \p upper of a scenario
+   typename SPxSolverBase<R>::VarStatus _scenarioVarStatus(typename SPxSolverBase<R>::VarStatus status, R lower,
+         R upper) const;
+
+   /// orders the scenarios in a chain starting from the real LP, where each scenario is followed by its nearest
+   /// unchained scenario
+   void _chainScenarios(const std::vector<Scenario>& scenarios, const VectorBase<R>& baseLhs,
+                        const VectorBase<R>& baseRhs, const VectorBase<R>& baseLower, const VectorBase<R>& baseUpper,
+                        std::vector<int>& chain);
+
+   ///@}
+
+   ///@name Private methods for the automatic algorithm selection implemented in autoselect.hpp
+   ///@{
+
+   /// sets representation, algorithm, pricer and ratio tester according to the features of the real LP
+   void _autoSelect();
+
+   /// returns the threshold minimizing the total time if the instances with feature value above the threshold take
+   /// \p timeAbove and the others \p timeBelow; ties are broken towards \p current
+   static Real _learnThreshold(const std::vector<Real>& feature, const std::vector<Real>& timeBelow,
+                               const std::vector<Real>& timeAbove, Real current, Real lower);
+
+   ///@}
+
+   ///@name Private methods for parameter tuning implemented in tuning.hpp
+   ///@{
+
+   /// sets all parameters except the verbosity to their values in \p newSettings; unlike setSettings(), parameters
+   /// that do not change are not set again
+   void _changeParams(const Settings& newSettings);
+
+   /// solves every LP of \p filenames with every configuration of \p configs using THREADS parallel runs, where LP i
+   /// is stopped after \p timeLimits[i] seconds; stores the wall-clock solving time of configuration c on LP i in
+   /// \p times[c * filenames.size() + i], twice the time limit if the LP was not solved, or -1 if it could not be read
+   void _tuningRuns(const std::vector<std::string>& filenames, const std::vector<Settings>& configs,
+                    const std::vector<Real>& timeLimits, std::vector<Real>& times);
+
+   ///@}
 };
 
 /* Backwards compatibility */
@@ -2618,5 +2885,9 @@ typedef SoPlexBase<Real> SoPlex;
 #include "soplex/solverational.hpp"
 #include "soplex/testsoplex.hpp"
 #include "soplex/solvereal.hpp"
+#include "soplex/solvescenarios.hpp"
+#include "soplex/ranging.hpp"
+#include "soplex/autoselect.hpp"
+#include "soplex/tuning.hpp"
 
 #endif // _SOPLEX_H_
@@ -194,6 +194,18 @@ SoPlexBase<R>::Settings::BoolParam::BoolParam()
    description[SoPlexBase<R>::SIMPLIFIER_DOMINATEDCOLS] =
       "enable presolver DominatedCols in PaPILO";
    defaultValue[SoPlexBase<R>::SIMPLIFIER_DOMINATEDCOLS] = true;
+
+   // solve the real LP with lazily generated rows?
+   name[SoPlexBase<R>::LAZYROWS] = "lazyrows";
+   description[SoPlexBase<R>::LAZYROWS] =
+      "solve the real LP on a small set of active rows and add violated rows lazily?";
+   defaultValue[SoPlexBase<R>::LAZYROWS] = false;
+
+   // choose representation, algorithm, pricer and ratio tester from features of the LP?
+   name[SoPlexBase<R>::AUTOSELECT] = "autoselect";
+   description[SoPlexBase<R>::AUTOSELECT] =
+      "choose representation, algorithm, pricer and ratio tester of the floating-point solve from features of the LP?";
+   defaultValue[SoPlexBase<R>::AUTOSELECT] = false;
 }
 
 template <class R>
@@ -216,9 +228,9 @@ SoPlexBase<R>::Settings::IntParam::IntParam()
 
    // type of algorithm, i.e., primal or dual
    name[SoPlexBase<R>::ALGORITHM] = "algorithm";
-   description[SoPlexBase<R>::ALGORITHM] = "type of algorithm (0 - primal, 1 - dual)";
+   description[SoPlexBase<R>::ALGORITHM] = "type of algorithm (0 - primal, 1 - dual, 2 - barrier with crossover)";
    lower[SoPlexBase<R>::ALGORITHM] = 0;
-   upper[SoPlexBase<R>::ALGORITHM] = 1;
+   upper[SoPlexBase<R>::ALGORITHM] = 2;
    defaultValue[SoPlexBase<R>::ALGORITHM] = SoPlexBase<R>::ALGORITHM_DUAL;
 
    // type of LU update
@@ -308,9 +320,9 @@ SoPlexBase<R>::Settings::IntParam::IntParam()
    // type of ratio test
    name[SoPlexBase<R>::RATIOTESTER] = "ratiotester";
    description[SoPlexBase<R>::RATIOTESTER] =
-      "method for ratio test (0 - textbook, 1 - harris, 2 - fast, 3 - boundflipping)";
+      "method for ratio test (0 - textbook, 1 - harris, 2 - fast, 3 - boundflipping, 4 - packed harris)";
    lower[SoPlexBase<R>::RATIOTESTER] = 0;
-   upper[SoPlexBase<R>::RATIOTESTER] = 3;
+   upper[SoPlexBase<R>::RATIOTESTER] = 4;
    defaultValue[SoPlexBase<R>::RATIOTESTER] = SoPlexBase<R>::RATIOTESTER_BOUNDFLIPPING;
 
    // mode for synchronizing real and rational LP
@@ -420,9 +432,9 @@ SoPlexBase<R>::Settings::IntParam::IntParam()
    // printing condition number during the solve
    name[SoPlexBase<R>::PRINTBASISMETRIC] = "printbasismetric";
    description[SoPlexBase<R>::PRINTBASISMETRIC] =
-      "print basis metric during the solve (-1 - off, 0 - condition estimate , 1 - trace, 2 - determinant, 3 - condition)";
+      "print basis metric during the solve (-1 - off, 0 - condition estimate , 1 - trace, 2 - determinant, 3 - condition, 4 - 1-norm condition estimate)";
    lower[SoPlexBase<R>::PRINTBASISMETRIC] = -1;
-   upper[SoPlexBase<R>::PRINTBASISMETRIC] = 3;
+   upper[SoPlexBase<R>::PRINTBASISMETRIC] = 4;
    defaultValue[SoPlexBase<R>::PRINTBASISMETRIC] = -1;
 
    /// measure time spent in solving steps, e.g. factorization time
@@ -432,6 +444,54 @@ SoPlexBase<R>::Settings::IntParam::IntParam()
    lower[SoPlexBase<R>::STATTIMER] = 0;
    upper[SoPlexBase<R>::STATTIMER] = 2;
    defaultValue[SoPlexBase<R>::STATTIMER] = 1;
+
+   // number of threads used for parallelized parts of the solving process
+   name[SoPlexBase<R>::THREADS] = "threads";
+   description[SoPlexBase<R>::THREADS] =
+      "number of threads used for parallelized parts of the solving process, e.g., presolving with PaPILO";
+   lower[SoPlexBase<R>::THREADS] = 1;
+   upper[SoPlexBase<R>::THREADS] = INT_MAX;
+   defaultValue[SoPlexBase<R>::THREADS] = 1;
+
+   // maximum number of candidates tried during solution polishing
+   name[SoPlexBase<R>::POLISHING_LIMIT] = "polishing_limit";
+   description[SoPlexBase<R>::POLISHING_LIMIT] =
+      "maximum number of candidates tried during solution polishing (-1: no limit)";
+   lower[SoPlexBase<R>::POLISHING_LIMIT] = -1;
+   upper[SoPlexBase<R>::POLISHING_LIMIT] = INT_MAX;
+   defaultValue[SoPlexBase<R>::POLISHING_LIMIT] = -1;
+
+   // maximum number of rows added in one round of lazy row generation
+   name[SoPlexBase<R>::LAZYROWS_BATCH] = "lazyrows_batch";
+   description[SoPlexBase<R>::LAZYROWS_BATCH] =
+      "maximum number of violated rows added in one round of lazy row generation";
+   lower[SoPlexBase<R>::LAZYROWS_BATCH] = 1;
+   upper[SoPlexBase<R>::LAZYROWS_BATCH] = INT_MAX;
+   defaultValue[SoPlexBase<R>::LAZYROWS_BATCH] = 1000;
+
+   // number of consecutive rounds with basic slack after which a lazy row is dropped again
+   name[SoPlexBase<R>::LAZYROWS_AGE] = "lazyrows_age";
+   description[SoPlexBase<R>::LAZYROWS_AGE] =
+      "number of consecutive rounds with basic slack after which a lazily added row is dropped again (-1: never)";
+   lower[SoPlexBase<R>::LAZYROWS_AGE] = -1;
+   upper[SoPlexBase<R>::LAZYROWS_AGE] = INT_MAX;
+   defaultValue[SoPlexBase<R>::LAZYROWS_AGE] = 5;
+
+   // maximum number of nonzeros moved by one incremental compaction step of the LP matrix memory
+   name[SoPlexBase<R>::MEMPACK_SLICE] = "mempack_slice";
+   description[SoPlexBase<R>::MEMPACK_SLICE] =
+      "maximum number of nonzeros moved by one incremental compaction step of the LP matrix memory (0: compact at once)";
+   lower[SoPlexBase<R>::MEMPACK_SLICE] = 0;
+   upper[SoPlexBase<R>::MEMPACK_SLICE] = INT_MAX;
+   defaultValue[SoPlexBase<R>::MEMPACK_SLICE] = 0;
+
+   // number of iterations between two checkpoints of a floating-point solve
+   name[SoPlexBase<R>::CHECKPOINT_ITER] = "checkpoint_iter";
+   description[SoPlexBase<R>::CHECKPOINT_ITER] =
+      "number of iterations between two checkpoints of a floating-point solve (0: no iteration-based checkpoints)";
+   lower[SoPlexBase<R>::CHECKPOINT_ITER] = 0;
+   upper[SoPlexBase<R>::CHECKPOINT_ITER] = INT_MAX;
+   defaultValue[SoPlexBase<R>::CHECKPOINT_ITER] = 0;
 }
 
 template <class R>
@@ -638,6 +698,38 @@ SoPlexBase<R>::Settings::RealParam::RealParam()
    upper[SoPlexBase<R>::SIMPLIFIER_MODIFYROWFAC] = 1;
    defaultValue[SoPlexBase<R>::SIMPLIFIER_MODIFYROWFAC] = 1.0;
 
+   // number of seconds between two checkpoints of a floating-point solve
+   name[SoPlexBase<R>::CHECKPOINT_TIME] = "checkpoint_time";
+   description[SoPlexBase<R>::CHECKPOINT_TIME] =
+      "number of seconds between two checkpoints of a floating-point solve (0: no time-based checkpoints)";
+   lower[SoPlexBase<R>::CHECKPOINT_TIME] = 0.0;
+   upper[SoPlexBase<R>::CHECKPOINT_TIME] = DEFAULT_INFINITY;
+   defaultValue[SoPlexBase<R>::CHECKPOINT_TIME] = 600.0;
+
+   // maximum fraction of rows violated at the starting point for which the automatic selection uses the primal simplex
+   name[SoPlexBase<R>::AUTOSELECT_PRIMAL] = "autoselect_primal";
+   description[SoPlexBase<R>::AUTOSELECT_PRIMAL] =
+      "maximum fraction of rows violated at the starting point for which the automatic selection uses the primal simplex (negative: never)";
+   lower[SoPlexBase<R>::AUTOSELECT_PRIMAL] = -1.0;
+   upper[SoPlexBase<R>::AUTOSELECT_PRIMAL] = 1.0;
+   defaultValue[SoPlexBase<R>::AUTOSELECT_PRIMAL] = 0.0;
+
+   // fraction of degenerate rows at the starting point above which the automatic selection uses steepest edge pricing
+   name[SoPlexBase<R>::AUTOSELECT_STEEP] = "autoselect_steep";
+   description[SoPlexBase<R>::AUTOSELECT_STEEP] =
+      "fraction of rows with activity at a side at the starting point above which the automatic selection uses steepest edge instead of devex pricing";
+   lower[SoPlexBase<R>::AUTOSELECT_STEEP] = -1.0;
+   upper[SoPlexBase<R>::AUTOSELECT_STEEP] = 1.0;
+   defaultValue[SoPlexBase<R>::AUTOSELECT_STEEP] = 0.1;
+
+   // fraction of boxed columns above which the automatic selection uses the bound flipping ratio test
+   name[SoPlexBase<R>::AUTOSELECT_BOUNDFLIP] = "autoselect_boundflip";
+   description[SoPlexBase<R>::AUTOSELECT_BOUNDFLIP] =
+      "fraction of boxed columns above which the automatic selection uses the bound flipping instead of the fast ratio test";
+   lower[SoPlexBase<R>::AUTOSELECT_BOUNDFLIP] = -1.0;
+   upper[SoPlexBase<R>::AUTOSELECT_BOUNDFLIP] = 1.0;
+   defaultValue[SoPlexBase<R>::AUTOSELECT_BOUNDFLIP] = 0.0;
+
 }
 
 template <class R>
@@ -1209,33 +1301,34 @@ bool SoPlexBase<R>::getBoundViolation(R& maxviol, R& sumviol)
    VectorBase<R>& primal = _solReal._primal;
    assert(primal.dim() == numCols());
 
-   maxviol = 0.0;
-   sumviol = 0.0;
-
-   for(int i = numCols() - 1; i >= 0; i--)
+   spxParallelViolation(intParam(SoPlexBase<R>::THREADS), numCols(), maxviol, sumviol,
+                        [&](int first, int last, R & blockmax, R & blocksum)
    {
-      R lower = _realLP->lowerUnscaled(i);
-      R upper = _realLP->upperUnscaled(i);
-      R viol = lower - primal[i];
-
-      if(viol > 0.0)
+      for(int i = first; i < last; i++)
       {
-         sumviol += viol;
+         R lower = _realLP->lowerUnscaled(i);
+         R upper = _realLP->upperUnscaled(i);
+         R viol = lower - primal[i];
 
-         if(viol > maxviol)
-            maxviol = viol;
-      }
+         if(viol > 0.0)
+         {
+            blocksum += viol;
 
-      viol = primal[i] - upper;
+            if(viol > blockmax)
+               blockmax = viol;
+         }
 
-      if(viol > 0.0)
-      {
-         sumviol += viol;
+         viol = primal[i] - upper;
 
-         if(viol > maxviol)
-            maxviol = viol;
+         if(viol > 0.0)
+         {
+            blocksum += viol;
+
+            if(viol > blockmax)
+               blockmax = viol;
+         }
       }
-   }
+   });
 
    return true;
 }
@@ -1254,6 +1347,46 @@ bool SoPlexBase<R>::getRedCost(VectorBase<R>& vector)
       return false;
 }
 
+
+
+/// computes the reduced costs of the candidate columns \p lpcolset with respect to the current dual solution;
+/// returns true on success
+// The objective and column vectors of the candidates are taken unscaled and in the objective sense of the LP, such
+// that the result is consistent with getRedCost().  Every reduced cost is computed as one dot product, hence the
+// result does not depend on the number of threads.
+template <class R>
+bool SoPlexBase<R>::getRedCostCandidatesReal(const LPColSetBase<R>& lpcolset, VectorBase<R>& redcost)
+{
+   if(!hasSol() || redcost.dim() < lpcolset.num())
+      return false;
+
+   _syncRealSolution();
+
+   if(!_solReal.isDualFeasible())
+      return false;
+
+   const VectorBase<R>& dual = _solReal._dual;
+
+   spxParallelForRange(intParam(SoPlexBase<R>::THREADS), lpcolset.num(), [&](int first, int last)
+   {
+      for(int i = first; i < last; i++)
+      {
+         const SVectorBase<R>& colVector = lpcolset.colVector(i);
+         R activity = 0;
+
+         for(int k = 0; k < colVector.size(); k++)
+         {
+            assert(colVector.index(k) < dual.dim());
+            activity += colVector.value(k) * dual[colVector.index(k)];
+         }
+
+         redcost[i] = lpcolset.maxObj(i) - activity;
+      }
+   });
+
+   return true;
+}
+
 /// gets violation of constraints; returns true on success
 template <class R>
 bool SoPlexBase<R>::getRowViolation(R& maxviol, R& sumviol)
@@ -1267,34 +1400,36 @@ bool SoPlexBase<R>::getRowViolation(R& maxviol, R& sumviol)
 
    VectorBase<R> activity(numRows());
    _realLP->computePrimalActivity(primal, activity, true);
-   maxviol = 0.0;
-   sumviol = 0.0;
 
-   for(int i = numRows() - 1; i >= 0; i--)
+   spxParallelViolation(intParam(SoPlexBase<R>::THREADS), numRows(), maxviol, sumviol,
+                        [&](int first, int last, R & blockmax, R & blocksum)
    {
-      R lhs = _realLP->lhsUnscaled(i);
-      R rhs = _realLP->rhsUnscaled(i);
+      for(int i = first; i < last; i++)
+      {
+         R lhs = _realLP->lhsUnscaled(i);
+         R rhs = _realLP->rhsUnscaled(i);
 
-      R viol = lhs - activity[i];
+         R viol = lhs - activity[i];
 
-      if(viol > 0.0)
-      {
-         sumviol += viol;
+         if(viol > 0.0)
+         {
+            blocksum += viol;
 
-         if(viol > maxviol)
-            maxviol = viol;
-      }
+            if(viol > blockmax)
+               blockmax = viol;
+         }
 
-      viol = activity[i] - rhs;
+         viol = activity[i] - rhs;
 
-      if(viol > 0.0)
-      {
-         sumviol += viol;
+         if(viol > 0.0)
+         {
+            blocksum += viol;
 
-         if(viol > maxviol)
-            maxviol = viol;
+            if(viol > blockmax)
+               blockmax = viol;
+         }
       }
-   }
+   });
 
    return true;
 }
@@ -1310,50 +1445,53 @@ bool SoPlexBase<R>::getDualViolation(R& maxviol, R& sumviol)
    VectorBase<R>& dual = _solReal._dual;
    assert(dual.dim() == numRows());
 
-   maxviol = 0.0;
-   sumviol = 0.0;
+   bool minimize = (intParam(SoPlexBase<R>::OBJSENSE) == OBJSENSE_MINIMIZE);
 
-   for(int r = numRows() - 1; r >= 0; r--)
+   spxParallelViolation(intParam(SoPlexBase<R>::THREADS), numRows(), maxviol, sumviol,
+                        [&](int first, int last, R & blockmax, R & blocksum)
    {
-      typename SPxSolverBase<R>::VarStatus rowStatus = basisRowStatus(r);
-
-      if(intParam(SoPlexBase<R>::OBJSENSE) == OBJSENSE_MINIMIZE)
+      for(int r = first; r < last; r++)
       {
-         if(rowStatus != SPxSolverBase<R>::ON_UPPER && rowStatus != SPxSolverBase<R>::FIXED && dual[r] < 0.0)
+         typename SPxSolverBase<R>::VarStatus rowStatus = basisRowStatus(r);
+
+         if(minimize)
          {
-            sumviol += -dual[r];
+            if(rowStatus != SPxSolverBase<R>::ON_UPPER && rowStatus != SPxSolverBase<R>::FIXED && dual[r] < 0.0)
+            {
+               blocksum += -dual[r];
 
-            if(dual[r] < -maxviol)
-               maxviol = -dual[r];
-         }
+               if(dual[r] < -blockmax)
+                  blockmax = -dual[r];
+            }
 
-         if(rowStatus != SPxSolverBase<R>::ON_LOWER && rowStatus != SPxSolverBase<R>::FIXED && dual[r] > 0.0)
-         {
-            sumviol += dual[r];
+            if(rowStatus != SPxSolverBase<R>::ON_LOWER && rowStatus != SPxSolverBase<R>::FIXED && dual[r] > 0.0)
+            {
+               blocksum += dual[r];
 
-            if(dual[r] > maxviol)
-               maxviol = dual[r];
+               if(dual[r] > blockmax)
+                  blockmax = dual[r];
+            }
          }
-      }
-      else
-      {
-         if(rowStatus != SPxSolverBase<R>::ON_UPPER && rowStatus != SPxSolverBase<R>::FIXED && dual[r] > 0.0)
+         else
          {
-            sumviol += dual[r];
+            if(rowStatus != SPxSolverBase<R>::ON_UPPER && rowStatus != SPxSolverBase<R>::FIXED && dual[r] > 0.0)
+            {
+               blocksum += dual[r];
 
-            if(dual[r] > maxviol)
-               maxviol = dual[r];
-         }
+               if(dual[r] > blockmax)
+                  blockmax = dual[r];
+            }
 
-         if(rowStatus != SPxSolverBase<R>::ON_LOWER && rowStatus != SPxSolverBase<R>::FIXED && dual[r] < 0.0)
-         {
-            sumviol += -dual[r];
+            if(rowStatus != SPxSolverBase<R>::ON_LOWER && rowStatus != SPxSolverBase<R>::FIXED && dual[r] < 0.0)
+            {
+               blocksum += -dual[r];
 
-            if(dual[r] < -maxviol)
-               maxviol = -dual[r];
+               if(dual[r] < -blockmax)
+                  blockmax = -dual[r];
+            }
          }
       }
-   }
+   });
 
    return true;
 }
@@ -1369,54 +1507,57 @@ bool SoPlexBase<R>::getRedCostViolation(R& maxviol, R& sumviol)
    VectorBase<R>& redcost = _solReal._redCost;
    assert(redcost.dim() == numCols());
 
-   maxviol = 0.0;
-   sumviol = 0.0;
+   bool minimize = (intParam(SoPlexBase<R>::OBJSENSE) == OBJSENSE_MINIMIZE);
 
-   for(int c = numCols() - 1; c >= 0; c--)
+   spxParallelViolation(intParam(SoPlexBase<R>::THREADS), numCols(), maxviol, sumviol,
+                        [&](int first, int last, R & blockmax, R & blocksum)
    {
-      typename SPxSolverBase<R>::VarStatus colStatus = basisColStatus(c);
-
-      if(intParam(SoPlexBase<R>::OBJSENSE) == OBJSENSE_MINIMIZE)
+      for(int c = first; c < last; c++)
       {
-         if(colStatus != SPxSolverBase<R>::ON_UPPER && colStatus != SPxSolverBase<R>::FIXED
-               && redcost[c] < 0.0)
+         typename SPxSolverBase<R>::VarStatus colStatus = basisColStatus(c);
+
+         if(minimize)
          {
-            sumviol += -redcost[c];
+            if(colStatus != SPxSolverBase<R>::ON_UPPER && colStatus != SPxSolverBase<R>::FIXED
+                  && redcost[c] < 0.0)
+            {
+               blocksum += -redcost[c];
 
-            if(redcost[c] < -maxviol)
-               maxviol = -redcost[c];
-         }
+               if(redcost[c] < -blockmax)
+                  blockmax = -redcost[c];
+            }
 
-         if(colStatus != SPxSolverBase<R>::ON_LOWER && colStatus != SPxSolverBase<R>::FIXED
-               && redcost[c] > 0.0)
-         {
-            sumviol += redcost[c];
+            if(colStatus != SPxSolverBase<R>::ON_LOWER && colStatus != SPxSolverBase<R>::FIXED
+                  && redcost[c] > 0.0)
+            {
+               blocksum += redcost[c];
 
-            if(redcost[c] > maxviol)
-               maxviol = redcost[c];
+               if(redcost[c] > blockmax)
+                  blockmax = redcost[c];
+            }
          }
-      }
-      else
-      {
-         if(colStatus != SPxSolverBase<R>::ON_UPPER && colStatus != SPxSolverBase<R>::FIXED
-               && redcost[c] > 0.0)
+         else
          {
-            sumviol += redcost[c];
+            if(colStatus != SPxSolverBase<R>::ON_UPPER && colStatus != SPxSolverBase<R>::FIXED
+                  && redcost[c] > 0.0)
+            {
+               blocksum += redcost[c];
 
-            if(redcost[c] > maxviol)
-               maxviol = redcost[c];
-         }
+               if(redcost[c] > blockmax)
+                  blockmax = redcost[c];
+            }
 
-         if(colStatus != SPxSolverBase<R>::ON_LOWER && colStatus != SPxSolverBase<R>::FIXED
-               && redcost[c] < 0.0)
-         {
-            sumviol += -redcost[c];
+            if(colStatus != SPxSolverBase<R>::ON_LOWER && colStatus != SPxSolverBase<R>::FIXED
+                  && redcost[c] < 0.0)
+            {
+               blocksum += -redcost[c];
 
-            if(redcost[c] < -maxviol)
-               maxviol = -redcost[c];
+               if(redcost[c] < -blockmax)
+                  blockmax = -redcost[c];
+            }
          }
       }
-   }
+   });
 
    return true;
 }
@@ -1461,6 +1602,7 @@ SoPlexBase<R>& SoPlexBase<R>::operator=(const SoPlexBase<R>& rhs)
       _ratiotesterHarris = rhs._ratiotesterHarris;
       _ratiotesterFast = rhs._ratiotesterFast;
       _ratiotesterBoundFlipping = rhs._ratiotesterBoundFlipping;
+      _ratiotesterPacked = rhs._ratiotesterPacked;
 
       // copy solution data
       _status = rhs._status;
@@ -1527,6 +1669,9 @@ SoPlexBase<R>& SoPlexBase<R>::operator=(const SoPlexBase<R>& rhs)
       _hasSolRational = rhs._hasSolRational;
       _hasBasis = rhs._hasBasis;
       _applyPolishing = rhs._applyPolishing;
+      _colGenWarmStart = rhs._colGenWarmStart;
+      _warmStartRowScaleExp = rhs._warmStartRowScaleExp;
+      _warmStartColScaleExp = rhs._warmStartColScaleExp;
 
       // rational constants do not need to be assigned
 #ifdef SOPLEX_WITH_BOOST
@@ -2113,6 +2258,30 @@ void SoPlexBase<R>::addColsReal(const LPColSetBase<R>& lpcolset)
 
 
 
+/// adds multiple columns generated in a pricing round
+// When the LP is loaded, the columns are appended directly to the solver, where SPxSolverBase::addedCols() keeps the
+// basis and makes the new columns nonbasic; a persistently scaled LP scales them with the existing row factors.  The
+// basis hence stays primal feasible up to the bounds of the new columns, and the next solve skips presolving and
+// rescaling and starts the primal simplex from it.
+template <class R>
+void SoPlexBase<R>::addColsWarmStartReal(const LPColSetBase<R>& lpcolset)
+{
+   assert(_realLP != 0);
+
+   _addColsReal(lpcolset);
+
+   if(intParam(SoPlexBase<R>::SYNCMODE) == SYNCMODE_AUTO)
+   {
+      _rationalLP->addCols(lpcolset);
+      _completeRangeTypesRational();
+   }
+
+   _invalidateSolution();
+   _colGenWarmStart = _hasBasis;
+}
+
+
+
 /// replaces row \p i with \p lprow
 template <class R>
 void SoPlexBase<R>::changeRowReal(int i, const LPRowBase<R>& lprow)
@@ -2496,6 +2665,25 @@ void SoPlexBase<R>::changeElementReal(int i, int j, const R& val)
 
 
 
+/// changes the matrix entries in rows \p rows[k] and columns \p cols[k] to \p vals[k] for k = 0, ..., \p n - 1
+template <class R>
+void SoPlexBase<R>::changeElementsReal(int n, const int rows[], const int cols[], const R vals[])
+{
+   assert(_realLP != 0);
+
+   _changeElementsReal(n, rows, cols, vals);
+
+   if(intParam(SoPlexBase<R>::SYNCMODE) == SYNCMODE_AUTO)
+   {
+      std::vector<Rational> rationalVals(vals, vals + n);
+      _rationalLP->changeElements(n, rows, cols, rationalVals.data());
+   }
+
+   _invalidateSolution();
+}
+
+
+
 /// removes row \p i
 template <class R>
 void SoPlexBase<R>::removeRowReal(int i)
@@ -5847,6 +6035,12 @@ bool SoPlexBase<R>::setBoolParam(const BoolParam param, const bool value, const
 #endif
       break;
 
+   case LAZYROWS:
+      break;
+
+   case AUTOSELECT:
+      break;
+
    default:
       return false;
    }
@@ -5896,7 +6090,7 @@ bool SoPlexBase<R>::setIntParam(const IntParam param, const int value, const boo
 
       break;
 
-   // type of algorithm, i.e., primal or dual
+   // type of algorithm, i.e., primal, dual, or barrier
    case SoPlexBase<R>::ALGORITHM:
       // decide upon entering/leaving at solve time depending on representation
       break;
@@ -6217,6 +6411,10 @@ bool SoPlexBase<R>::setIntParam(const IntParam param, const int value, const boo
          _solver.setTester(&_ratiotesterBoundFlipping);
          break;
 
+      case RATIOTESTER_PACKED:
+         _solver.setTester(&_ratiotesterPacked);
+         break;
+
       default:
          return false;
       }
@@ -6315,6 +6513,46 @@ bool SoPlexBase<R>::setIntParam(const IntParam param, const int value, const boo
       setTimings((Timer::TYPE) value);
       break;
 
+   // number of threads
+   case THREADS:
+      _simplifierPaPILO.setThreads(value);
+      _solver.setThreads(value);
+
+      if(_realLP != &_solver)
+         _realLP->setThreads(value);
+
+      if(_rationalLP != 0)
+         _rationalLP->setThreads(value);
+
+      break;
+
+   // maximum number of candidates tried during solution polishing
+   case POLISHING_LIMIT:
+      _solver.setSolutionPolishingLimit(value);
+      break;
+
+   case LAZYROWS_BATCH:
+      break;
+
+   case LAZYROWS_AGE:
+      break;
+
+   // incremental compaction of the LP matrix memory
+   case MEMPACK_SLICE:
+      _solver.setMemPackSlice(value);
+
+      if(_realLP != &_solver)
+         _realLP->setMemPackSlice(value);
+
+      if(_rationalLP != 0)
+         _rationalLP->setMemPackSlice(value);
+
+      break;
+
+   case CHECKPOINT_ITER:
+      _solver.setCheckpoint(_solver.checkpointFile(), value, realParam(SoPlexBase<R>::CHECKPOINT_TIME));
+      break;
+
    default:
       return false;
    }
@@ -6508,6 +6746,15 @@ bool SoPlexBase<R>::setRealParam(const RealParam param, const Real value, const
 #endif
       break;
 
+   case SoPlexBase<R>::CHECKPOINT_TIME:
+      _solver.setCheckpoint(_solver.checkpointFile(), intParam(SoPlexBase<R>::CHECKPOINT_ITER), value);
+      break;
+
+   case SoPlexBase<R>::AUTOSELECT_PRIMAL:
+   case SoPlexBase<R>::AUTOSELECT_STEEP:
+   case SoPlexBase<R>::AUTOSELECT_BOUNDFLIP:
+      break;
+
    default:
       return false;
    }
@@ -7828,7 +8075,7 @@ void SoPlexBase<R>::_changeElementReal(int i, int j, const R& val)
    }
    else if(_hasBasis)
    {
-      if(_basisStatusRows[i] != SPxSolverBase<R>::BASIC && _basisStatusCols[i] == SPxSolverBase<R>::BASIC)
+      if(_basisStatusRows[i] != SPxSolverBase<R>::BASIC && _basisStatusCols[j] == SPxSolverBase<R>::BASIC)
          _hasBasis = false;
    }
 
@@ -7837,6 +8084,34 @@ void SoPlexBase<R>::_changeElementReal(int i, int j, const R& val)
 
 
 
+/// changes the matrix entries in rows \p rows[k] and columns \p cols[k] to \p vals[k] and adjusts basis
+template <class R>
+void SoPlexBase<R>::_changeElementsReal(int n, const int rows[], const int cols[], const R vals[])
+{
+   assert(_realLP != 0);
+
+   bool scale = _realLP->isScaled();
+   _realLP->changeElements(n, rows, cols, vals, scale);
+
+   if(_isRealLPLoaded)
+   {
+      _hasBasis = (_solver.basis().status() > SPxBasisBase<R>::NO_PROBLEM);
+   }
+   else if(_hasBasis)
+   {
+      for(int k = 0; k < n && _hasBasis; k++)
+      {
+         if(rows[k] >= 0 && cols[k] >= 0 && _basisStatusRows[rows[k]] != SPxSolverBase<R>::BASIC
+               && _basisStatusCols[cols[k]] == SPxSolverBase<R>::BASIC)
+            _hasBasis = false;
+      }
+   }
+
+   _rationalLUSolver.clear();
+}
+
+
+
 /// removes row \p i and adjusts basis
 template <class R>
 void SoPlexBase<R>::_removeRowReal(int i)
@@ -7873,30 +8148,29 @@ void SoPlexBase<R>::_removeRowsReal(int perm[])
 {
    assert(_realLP != 0);
 
+   DataArray< typename SPxSolverBase<R>::VarStatus > rowStatus;
+   DataArray< typename SPxSolverBase<R>::VarStatus > colStatus;
+   bool keepBasis = _hasBasis && _basisAfterRemovingRows(perm, rowStatus, colStatus);
+
+   const int oldsize = numRows();
    _realLP->removeRows(perm);
 
-   if(_isRealLPLoaded)
-   {
-      _hasBasis = (_solver.basis().status() > SPxBasisBase<R>::NO_PROBLEM);
-   }
-   else if(_hasBasis)
+   if(keepBasis)
    {
-      for(int i = numRows() - 1; i >= 0 && _hasBasis; i--)
+      // move the row status of the remaining rows to their new positions
+      for(int i = 0; i < oldsize; i++)
       {
-         if(perm[i] < 0 && _basisStatusRows[i] != SPxSolverBase<R>::BASIC)
-            _hasBasis = false;
-         else if(perm[i] >= 0 && perm[i] != i)
-         {
-            assert(perm[i] < numRows());
-            assert(perm[perm[i]] < 0);
-
-            _basisStatusRows[perm[i]] = _basisStatusRows[i];
-         }
+         if(perm[i] >= 0)
+            rowStatus[perm[i]] = rowStatus[i];
       }
 
-      if(_hasBasis)
-         _basisStatusRows.reSize(numRows());
+      rowStatus.reSize(numRows());
+      setBasis(rowStatus.get_ptr(), colStatus.get_ptr());
    }
+   else if(_isRealLPLoaded)
+      _hasBasis = (_solver.basis().status() > SPxBasisBase<R>::NO_PROBLEM);
+   else
+      _hasBasis = false;
 
    _rationalLUSolver.clear();
 }
@@ -7939,54 +8213,483 @@ void SoPlexBase<R>::_removeColsReal(int perm[])
 {
    assert(_realLP != 0);
 
+   DataArray< typename SPxSolverBase<R>::VarStatus > rowStatus;
+   DataArray< typename SPxSolverBase<R>::VarStatus > colStatus;
+   bool keepBasis = _hasBasis && _basisAfterRemovingCols(perm, rowStatus, colStatus);
+
+   const int oldsize = numCols();
    _realLP->removeCols(perm);
 
-   if(_isRealLPLoaded)
-   {
-      _hasBasis = (_solver.basis().status() > SPxBasisBase<R>::NO_PROBLEM);
-   }
-   else if(_hasBasis)
+   if(keepBasis)
    {
-      for(int i = numCols() - 1; i >= 0 && _hasBasis; i--)
+      // move the column status of the remaining columns to their new positions
+      for(int j = 0; j < oldsize; j++)
       {
-         if(perm[i] < 0 && _basisStatusCols[i] == SPxSolverBase<R>::BASIC)
-            _hasBasis = false;
-         else if(perm[i] >= 0 && perm[i] != i)
-         {
-            assert(perm[i] < numCols());
-            assert(perm[perm[i]] < 0);
-
-            _basisStatusCols[perm[i]] = _basisStatusCols[i];
-         }
+         if(perm[j] >= 0)
+            colStatus[perm[j]] = colStatus[j];
       }
 
-      if(_hasBasis)
-         _basisStatusCols.reSize(numCols());
+      colStatus.reSize(numCols());
+      setBasis(rowStatus.get_ptr(), colStatus.get_ptr());
    }
+   else if(_isRealLPLoaded)
+      _hasBasis = (_solver.basis().status() > SPxBasisBase<R>::NO_PROBLEM);
+   else
+      _hasBasis = false;
 
    _rationalLUSolver.clear();
 }
 
 
 
-/// invalidates solution
+/// computes the basis that remains after removing all rows with an index \p i such that \p perm[i] < 0; for every
+/// removed row with nonbasic slack, one basic variable becomes nonbasic; returns false if no regular basis was found
+// With the basis matrix B of the formulation A x - s = 0, removing the rows I and the basic columns J from B leaves a
+// regular matrix if and only if the submatrix of B^-1 with rows J and columns I is regular.  Since the slack of a removed
+// row that is basic is removed together with the row, it suffices to choose the positions J' of the variables leaving
+// the basis such that B^-1 restricted to the rows J' and the removed rows with nonbasic slack is regular.
+//
+// A removed row is equivalent to a row with infinite sides, whose free slack enters the basis.  If a primal solution is
+// available, the slack moves in the direction that improves the objective and the leaving variable is determined by a
+// primal ratio test, such that a primal feasible basis stays primal feasible.
 template <class R>
-void SoPlexBase<R>::_invalidateSolution()
+bool SoPlexBase<R>::_basisAfterRemovingRows(const int perm[],
+      DataArray< typename SPxSolverBase<R>::VarStatus >& rowStatus,
+      DataArray< typename SPxSolverBase<R>::VarStatus >& colStatus)
 {
-   ///@todo maybe this should be done individually at the places when this method is called
-   _status = SPxSolverBase<R>::UNKNOWN;
+   const int nrows = numRows();
+   const int ncols = numCols();
 
-   _solReal.invalidate();
-   _hasSolReal = false;
+   rowStatus.reSize(nrows);
+   colStatus.reSize(ncols);
+   getBasis(rowStatus.get_ptr(), colStatus.get_ptr());
 
-   _solRational.invalidate();
-   _hasSolRational = false;
-}
+   std::vector<int> removed;
 
+   for(int i = 0; i < nrows; i++)
+   {
+      if(perm[i] < 0 && rowStatus[i] != SPxSolverBase<R>::BASIC)
+         removed.push_back(i);
+   }
 
+   if(removed.empty())
+      return true;
 
-/// enables simplifier and scaler
-template <class R>
+   // the ratio test works on the unscaled LP
+   std::unique_ptr< SPxLPBase<R> > unscaledLP;
+   const SPxLPBase<R>* lp = _realLP;
+
+   if(_realLP->isScaled())
+   {
+      assert(_scaler != 0);
+      unscaledLP.reset(new SPxLPBase<R>(*_realLP));
+      _scaler->unscale(*unscaledLP);
+      lp = unscaledLP.get();
+   }
+
+   SLUFactor<R> factor;
+   std::vector<int> basicVar;
+
+   if(!_factorizeBasisMatrix(*lp, rowStatus.get_ptr(), colStatus.get_ptr(), factor, basicVar))
+      return false;
+
+   const R infinity = realParam(SoPlexBase<R>::INFTY);
+   const R eps = realParam(SoPlexBase<R>::EPSILON_PIVOT);
+   const R sense = (intParam(SoPlexBase<R>::OBJSENSE) == OBJSENSE_MINIMIZE) ? 1.0 : -1.0;
+
+   VectorBase<R> primal(ncols);
+   VectorBase<R> slacks(nrows);
+   VectorBase<R> dual(nrows);
+   const bool hasValues = getPrimal(primal) && getSlacksReal(slacks) && getDual(dual);
+
+   // values and bounds of the basic variables by position; the slacks of removed rows are no candidates for leaving
+   std::vector<bool> candidate(nrows);
+   std::vector<R> value(nrows, 0.0);
+   std::vector<R> lower(nrows);
+   std::vector<R> upper(nrows);
+
+   for(int r = 0; r < nrows; r++)
+   {
+      int var = basicVar[r];
+
+      if(var >= 0)
+      {
+         candidate[r] = true;
+         value[r] = hasValues ? primal[var] : 0.0;
+         lower[r] = lp->lower(var);
+         upper[r] = lp->upper(var);
+      }
+      else
+      {
+         candidate[r] = (perm[-1 - var] >= 0);
+         value[r] = hasValues ? slacks[-1 - var] : 0.0;
+         lower[r] = lp->lhs(-1 - var);
+         upper[r] = lp->rhs(-1 - var);
+      }
+   }
+
+   DSVectorBase<R> unit(1);
+
+   auto solve = [&](int t, SSVectorBase<R>& vec)
+   {
+      unit.clear();
+      unit.add(removed[t], 1.0);
+      factor.solveRight(vec, unit);
+   };
+
+   // a change delta of the slack of removed row i changes the basic variables by delta * w
+   auto select = [&](int t, const VectorBase<R>& w, const std::vector<int>& nonzeros)
+   {
+      const int i = removed[t];
+      const R dir = (hasValues && sense * dual[i] > 0) ? -1.0 : 1.0;
+
+      int pivot = -1;
+      R minRatio = infinity;
+
+      if(hasValues)
+      {
+         for(int r : nonzeros)
+         {
+            if(!candidate[r] || spxAbs(w[r]) <= eps)
+               continue;
+
+            R rate = w[r] * dir;
+            R ratio = infinity;
+
+            if(rate > 0 && upper[r] < infinity)
+               ratio = MAXIMUM(upper[r] - value[r], R(0.0)) / rate;
+            else if(rate < 0 && lower[r] > -infinity)
+               ratio = MAXIMUM(value[r] - lower[r], R(0.0)) / -rate;
+
+            if(ratio < minRatio || (ratio == minRatio && pivot >= 0 && spxAbs(w[r]) > spxAbs(w[pivot])))
+            {
+               pivot = r;
+               minRatio = ratio;
+            }
+         }
+      }
+
+      typename SPxSolverBase<R>::VarStatus status;
+
+      if(pivot >= 0 && minRatio < infinity)
+      {
+         for(int r : nonzeros)
+            value[r] += w[r] * dir * minRatio;
+
+         if(lower[pivot] == upper[pivot])
+            status = SPxSolverBase<R>::FIXED;
+         else
+            status = (w[pivot] * dir > 0) ? SPxSolverBase<R>::ON_UPPER : SPxSolverBase<R>::ON_LOWER;
+      }
+      else
+      {
+         // without a blocking variable, the entry of largest absolute value is chosen as pivot
+         pivot = -1;
+         R maxabs = eps;
+
+         for(int r : nonzeros)
+         {
+            if(candidate[r] && spxAbs(w[r]) > maxabs)
+            {
+               pivot = r;
+               maxabs = spxAbs(w[r]);
+            }
+         }
+
+         if(pivot < 0)
+            return -1;
+
+         status = _repairedVarStatus(value[pivot], hasValues, lower[pivot], upper[pivot]);
+      }
+
+      if(basicVar[pivot] >= 0)
+         colStatus[basicVar[pivot]] = status;
+      else
+         rowStatus[-1 - basicVar[pivot]] = status;
+
+      candidate[pivot] = false;
+
+      return pivot;
+   };
+
+   std::vector<int> pivots;
+
+   return _selectRepairPivots(int(removed.size()), nrows, solve, select, pivots);
+}
+
+
+
+/// computes the basis that remains after removing all columns with an index \p i such that \p perm[i] < 0; for every
+/// removed basic column, the slack of a row with nonbasic slack becomes basic; returns false if no regular basis was
+/// found
+// Replacing the basic columns at the positions J of the basis matrix B by the slack columns of the rows I leaves a
+// regular matrix if and only if the submatrix of B^-1 with rows J and columns I is regular.
+template <class R>
+bool SoPlexBase<R>::_basisAfterRemovingCols(const int perm[],
+      DataArray< typename SPxSolverBase<R>::VarStatus >& rowStatus,
+      DataArray< typename SPxSolverBase<R>::VarStatus >& colStatus)
+{
+   const int nrows = numRows();
+   const int ncols = numCols();
+
+   rowStatus.reSize(nrows);
+   colStatus.reSize(ncols);
+   getBasis(rowStatus.get_ptr(), colStatus.get_ptr());
+
+   std::vector<int> removed;
+
+   for(int j = 0; j < ncols; j++)
+   {
+      if(perm[j] < 0 && colStatus[j] == SPxSolverBase<R>::BASIC)
+         removed.push_back(j);
+   }
+
+   if(removed.empty())
+      return true;
+
+   SLUFactor<R> factor;
+   std::vector<int> basicVar;
+
+   if(!_factorizeBasisMatrix(*_realLP, rowStatus.get_ptr(), colStatus.get_ptr(), factor, basicVar))
+      return false;
+
+   std::vector<int> position(ncols, -1);
+
+   for(int r = 0; r < nrows; r++)
+   {
+      if(basicVar[r] >= 0)
+         position[basicVar[r]] = r;
+   }
+
+   const R eps = realParam(SoPlexBase<R>::EPSILON_PIVOT);
+   DSVectorBase<R> unit(1);
+
+   auto solve = [&](int t, SSVectorBase<R>& vec)
+   {
+      unit.clear();
+      unit.add(position[removed[t]], 1.0);
+      factor.solveLeft(vec, unit);
+   };
+
+   // the slack of the row with the entry of largest absolute value among the rows with nonbasic slack enters the basis
+   auto select = [&](int t, const VectorBase<R>& rho, const std::vector<int>& nonzeros)
+   {
+      int pivot = -1;
+      R maxabs = eps;
+
+      for(int i : nonzeros)
+      {
+         if(rowStatus[i] != SPxSolverBase<R>::BASIC && spxAbs(rho[i]) > maxabs)
+         {
+            pivot = i;
+            maxabs = spxAbs(rho[i]);
+         }
+      }
+
+      if(pivot >= 0)
+         rowStatus[pivot] = SPxSolverBase<R>::BASIC;
+
+      return pivot;
+   };
+
+   std::vector<int> pivots;
+
+   return _selectRepairPivots(int(removed.size()), nrows, solve, select, pivots);
+}
+
+
+
+/// factorizes the basis matrix of \p lp given by \p rowStatus and \p colStatus in the formulation A x - s = 0; returns
+/// false if the basis has not exactly one basic variable per row or its matrix is singular
+// The basis matrix consists of the basic columns of [A -I], first the basic columns in increasing order, then the basic
+// slacks.  On return, basicVar[r] is the column or, if negative, the row -1-basicVar[r] of the basic variable at position
+// r.
+template <class R>
+bool SoPlexBase<R>::_factorizeBasisMatrix(const SPxLPBase<R>& lp,
+      const typename SPxSolverBase<R>::VarStatus rowStatus[],
+      const typename SPxSolverBase<R>::VarStatus colStatus[], SLUFactor<R>& factor, std::vector<int>& basicVar)
+{
+   const int nrows = lp.nRows();
+   const int ncols = lp.nCols();
+
+   std::vector< DSVectorBase<R> > slackVectors;
+   DataArray<const SVectorBase<R>*> basisVectors(nrows);
+
+   basicVar.clear();
+   basicVar.reserve(nrows);
+   slackVectors.reserve(nrows);
+
+   for(int j = 0; j < ncols; j++)
+   {
+      if(colStatus[j] == SPxSolverBase<R>::BASIC)
+      {
+         if(int(basicVar.size()) == nrows)
+            return false;
+
+         basisVectors[int(basicVar.size())] = &lp.colVector(j);
+         basicVar.push_back(j);
+      }
+   }
+
+   for(int i = 0; i < nrows; i++)
+   {
+      if(rowStatus[i] == SPxSolverBase<R>::BASIC)
+      {
+         if(int(basicVar.size()) == nrows)
+            return false;
+
+         slackVectors.emplace_back(1);
+         slackVectors.back().add(i, -1.0);
+         basisVectors[int(basicVar.size())] = &slackVectors.back();
+         basicVar.push_back(-1 - i);
+      }
+   }
+
+   if(int(basicVar.size()) != nrows)
+      return false;
+
+   factor.spxout = &spxout;
+
+   return nrows == 0 || factor.load(basisVectors.get_ptr(), nrows) == SLinSolver<R>::OK;
+}
+
+
+
+/// selects one index for each of the \p nvecs vectors given by \p solve(t, vec) by calling \p select(t, vec, nonzeros)
+/// such that the matrix of these vectors restricted to the selected indices is regular; returns false if \p select
+/// did not find an index
+// The vectors are eliminated one after the other against the previously eliminated vectors, as in an LU factorization
+// with row pivoting, where select() receives the eliminated vector and the indices of its nonzeros.  If the vectors
+// are the columns of B^-1 of the variables entering a basis B, the eliminated vector is the column of the entering
+// variable with respect to the basis after the previous exchanges, except for the previously selected indices.
+template <class R>
+template <class F, class G>
+bool SoPlexBase<R>::_selectRepairPivots(int nvecs, int dim, const F& solve, const G& select,
+                                        std::vector<int>& pivots)
+{
+   std::vector< DSVectorBase<R> > eliminated;
+   std::vector<R> pivotValues;
+   SSVectorBase<R> vec(dim);
+   VectorBase<R> work(dim);
+   std::vector<int> nonzeros;
+   std::vector<bool> isNonzero(dim, false);
+
+   eliminated.reserve(nvecs);
+   pivots.clear();
+
+   for(int t = 0; t < nvecs; t++)
+   {
+      solve(t, vec);
+
+      if(!vec.isSetup())
+         vec.setup();
+
+      for(int k = 0; k < vec.size(); k++)
+      {
+         int i = vec.index(k);
+         work[i] = vec[i];
+         isNonzero[i] = true;
+         nonzeros.push_back(i);
+      }
+
+      for(int s = 0; s < t; s++)
+      {
+         R factor = work[pivots[s]];
+
+         if(factor == 0)
+            continue;
+
+         factor /= pivotValues[s];
+
+         for(int k = 0; k < eliminated[s].size(); k++)
+         {
+            int i = eliminated[s].index(k);
+
+            if(!isNonzero[i])
+            {
+               isNonzero[i] = true;
+               nonzeros.push_back(i);
+            }
+
+            work[i] -= factor * eliminated[s].value(k);
+         }
+
+         work[pivots[s]] = 0;
+      }
+
+      int pivot = select(t, work, nonzeros);
+
+      if(pivot >= 0)
+      {
+         eliminated.emplace_back(int(nonzeros.size()));
+
+         for(int i : nonzeros)
+         {
+            if(isNotZero(work[i], realParam(SoPlexBase<R>::EPSILON_ZERO)))
+               eliminated.back().add(i, work[i]);
+         }
+
+         pivots.push_back(pivot);
+         pivotValues.push_back(work[pivot]);
+      }
+
+      for(int i : nonzeros)
+      {
+         work[i] = 0;
+         isNonzero[i] = false;
+      }
+
+      nonzeros.clear();
+
+      if(pivot < 0)
+         return false;
+   }
+
+   return true;
+}
+
+
+
+/// returns the nonbasic status of a variable with bounds \p lower and \p upper that leaves the basis at value \p value,
+/// which is only used if \p hasValue is true
+template <class R>
+typename SPxSolverBase<R>::VarStatus SoPlexBase<R>::_repairedVarStatus(R value, bool hasValue, R lower,
+      R upper) const
+{
+   if(lower == upper)
+      return SPxSolverBase<R>::FIXED;
+   else if(lower <= -realParam(SoPlexBase<R>::INFTY) && upper >= realParam(SoPlexBase<R>::INFTY))
+      return SPxSolverBase<R>::ZERO;
+   else if(lower <= -realParam(SoPlexBase<R>::INFTY))
+      return SPxSolverBase<R>::ON_UPPER;
+   else if(upper >= realParam(SoPlexBase<R>::INFTY))
+      return SPxSolverBase<R>::ON_LOWER;
+   else if(hasValue && upper - value < value - lower)
+      return SPxSolverBase<R>::ON_UPPER;
+   else
+      return SPxSolverBase<R>::ON_LOWER;
+}
+
+
+
+/// invalidates solution
+template <class R>
+void SoPlexBase<R>::_invalidateSolution()
+{
+   ///@todo maybe this should be done individually at the places when this method is called
+   _status = SPxSolverBase<R>::UNKNOWN;
+
+   _solReal.invalidate();
+   _hasSolReal = false;
+
+   _solRational.invalidate();
+   _hasSolRational = false;
+}
+
+
+
+/// enables simplifier and scaler
+template <class R>
 void SoPlexBase<R>::_enableSimplifierAndScaler()
 {
    // type of simplifier
@@ -8080,6 +8783,8 @@ void SoPlexBase<R>::_ensureRationalLP()
       spx_alloc(_rationalLP);
       _rationalLP = new(_rationalLP) SPxLPRational();
       _rationalLP->setOutstream(spxout);
+      _rationalLP->setThreads(intParam(SoPlexBase<R>::THREADS));
+      _rationalLP->setMemPackSlice(intParam(SoPlexBase<R>::MEMPACK_SLICE));
    }
 }
 
@@ -8113,6 +8818,57 @@ void SoPlexBase<R>::_ensureRealLPLoaded()
 
 
 
+/// solves the real LP by the interior point method and loads the basis from crossover into the solver; returns
+/// false if the interior point method did not converge
+template <class R>
+bool SoPlexBase<R>::_solveBarrierReal(volatile bool* interrupt)
+{
+   SPxBarrier<R> barrier;
+
+   barrier.spxout = &spxout;
+   barrier.setThreads(intParam(SoPlexBase<R>::THREADS));
+
+   if(realParam(SoPlexBase<R>::TIMELIMIT) < realParam(SoPlexBase<R>::INFTY))
+      barrier.setTimeLimit(Real(realParam(SoPlexBase<R>::TIMELIMIT)) - _statistics->solvingTime->time());
+
+   typename SPxBarrier<R>::Status status;
+   Real startTime = _statistics->solvingTime->time();
+
+   try
+   {
+      status = barrier.solve(_solver, interrupt);
+   }
+   catch(const std::bad_alloc&)
+   {
+      MSG_INFO1(spxout, spxout << "Barrier: out of memory.\n");
+      status = SPxBarrier<R>::FAILED;
+   }
+
+   _statistics->iterationsBarrier += barrier.iterations();
+   _statistics->barrierTime += _statistics->solvingTime->time() - startTime;
+
+   if(status != SPxBarrier<R>::OPTIMAL)
+   {
+      MSG_INFO1(spxout, spxout << "Barrier did not converge, solving by the simplex method from scratch.\n\n");
+      return false;
+   }
+
+   DataArray<typename SPxSolverBase<R>::VarStatus> rowstat(_solver.nRows());
+   DataArray<typename SPxSolverBase<R>::VarStatus> colstat(_solver.nCols());
+
+   startTime = _statistics->solvingTime->time();
+
+   barrier.crossover(_solver, rowstat.get_ptr(), colstat.get_ptr());
+   _solver.setBasis(rowstat.get_const_ptr(), colstat.get_const_ptr());
+
+   _statistics->crossoverTime += _statistics->solvingTime->time() - startTime;
+   _statistics->barrierTime += _statistics->solvingTime->time() - startTime;
+
+   return true;
+}
+
+
+
 /// call floating-point solver and update statistics on iterations etc.
 template <class R>
 void SoPlexBase<R>::_solveRealLPAndRecordStatistics(volatile bool* interrupt)
@@ -8155,17 +8911,37 @@ void SoPlexBase<R>::_solveRealLPAndRecordStatistics(volatile bool* interrupt)
       _solver.setRep(SPxSolverBase<R>::ROW);
    }
 
-   // set correct type
-   if(((intParam(ALGORITHM) == SoPlexBase<R>::ALGORITHM_PRIMAL
+   // run the interior point method if no starting basis is given; the basis from crossover is usually close to primal
+   // feasible, such that it is cleaned up by the primal simplex
+   bool crossover = false;
+
+   if(intParam(SoPlexBase<R>::ALGORITHM) == SoPlexBase<R>::ALGORITHM_BARRIER && !_hadBasis && !_colGenWarmStart
+         && !_solver.hasResumeData)
+   {
+      crossover = _solveBarrierReal(interrupt);
+
+      if(realParam(SoPlexBase<R>::TIMELIMIT) < realParam(SoPlexBase<R>::INFTY))
+         _solver.setTerminationTime(Real(realParam(SoPlexBase<R>::TIMELIMIT)) -
+                                    _statistics->solvingTime->time());
+   }
+
+   // set correct type; after generating columns, the basis is still primal feasible and the primal simplex is used
+   int algorithm = (_colGenWarmStart || crossover) ? SoPlexBase<R>::ALGORITHM_PRIMAL : intParam(ALGORITHM);
+
+   // without crossover, the barrier setting falls back to the dual simplex
+   if(algorithm == SoPlexBase<R>::ALGORITHM_BARRIER)
+      algorithm = SoPlexBase<R>::ALGORITHM_DUAL;
+
+   if(((algorithm == SoPlexBase<R>::ALGORITHM_PRIMAL
          && _solver.rep() == SPxSolverBase<R>::COLUMN)
-         || (intParam(ALGORITHM) == SoPlexBase<R>::ALGORITHM_DUAL && _solver.rep() == SPxSolverBase<R>::ROW))
+         || (algorithm == SoPlexBase<R>::ALGORITHM_DUAL && _solver.rep() == SPxSolverBase<R>::ROW))
          && _solver.type() != SPxSolverBase<R>::ENTER)
    {
       _solver.setType(SPxSolverBase<R>::ENTER);
    }
-   else if(((intParam(ALGORITHM) == SoPlexBase<R>::ALGORITHM_DUAL
+   else if(((algorithm == SoPlexBase<R>::ALGORITHM_DUAL
              && _solver.rep() == SPxSolverBase<R>::COLUMN)
-            || (intParam(ALGORITHM) == SoPlexBase<R>::ALGORITHM_PRIMAL
+            || (algorithm == SoPlexBase<R>::ALGORITHM_PRIMAL
                 && _solver.rep() == SPxSolverBase<R>::ROW))
            && _solver.type() != SPxSolverBase<R>::LEAVE)
    {
@@ -8215,7 +8991,12 @@ void SoPlexBase<R>::_solveRealLPAndRecordStatistics(volatile bool* interrupt)
    _statistics->iterationsPrimal += _solver.primalIterations();
    _statistics->iterationsFromBasis += _hadBasis ? _solver.iterations() : 0;
    _statistics->iterationsPolish += _solver.polishIterations();
+   _statistics->polishingTime += _solver.polishTime->time();
    _statistics->boundflips += _solver.boundFlips();
+   _statistics->unshiftTime += _solver.unShiftTime->time();
+   _statistics->shifts += _solver.shifts();
+   _statistics->unshifts += _solver.unShifts();
+   _statistics->iterationsCleanup += _solver.cleanupIterations();
    _statistics->multTimeSparse += _solver.multTimeSparse->time();
    _statistics->multTimeFull += _solver.multTimeFull->time();
    _statistics->multTimeColwise += _solver.multTimeColwise->time();
@@ -8392,9 +9173,12 @@ void SoPlexBase<R>::_syncLPReal(bool time)
    if(time)
       _statistics->syncTime->start();
 
-   // copy LP
+   // copy LP; the rational LP is converted directly into the solver without a temporary real LP
    if(_isRealLPLoaded)
-      _solver.loadLP((SPxLPBase<R>)(*_rationalLP));
+   {
+      _solver.loadLP(*_rationalLP);
+      _statistics->lpCopyMemorySaved += _solver.nzoMemory();
+   }
    else
       *_realLP = *_rationalLP;
 
@@ -8417,9 +9201,34 @@ void SoPlexBase<R>::_syncLPRational(bool time)
    if(time)
       _statistics->syncTime->start();
 
-   // copy LP
    _ensureRationalLP();
-   *_rationalLP = *_realLP;
+
+   // in sync mode ONLYREAL the rational LP is derived from the real LP only, hence a change of the real LP since the
+   // last sync can be detected by comparing hashes and only the changed rows and columns need to be converted
+   if(intParam(SoPlexBase<R>::SYNCMODE) == SYNCMODE_ONLYREAL && !_realLP->isScaled())
+   {
+      std::vector<uint64_t> rowSide;
+      std::vector<uint64_t> rowVec;
+      std::vector<uint64_t> col;
+
+      _hashLPReal(rowSide, rowVec, col);
+
+      if(!_updateLPRational(rowSide, rowVec, col))
+         *_rationalLP = *_realLP;
+
+      _syncRowSideHash.swap(rowSide);
+      _syncRowVecHash.swap(rowVec);
+      _syncColHash.swap(col);
+   }
+   else
+   {
+      *_rationalLP = *_realLP;
+
+      _syncRowSideHash.clear();
+      _syncRowVecHash.clear();
+      _syncColHash.clear();
+   }
+
    _recomputeRangeTypesRational();
 
    // stop timing
@@ -8429,6 +9238,192 @@ void SoPlexBase<R>::_syncLPRational(bool time)
 
 
 
+/// mixes a word into a hash value
+static inline uint64_t spxHashMix(uint64_t hash, uint64_t word)
+{
+   return hash ^ (word + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2));
+}
+
+/// mixes the exact value of a floating-point number into a hash value; works for every floating-point type R since
+/// the mantissa is extracted in chunks of 32 bits instead of reading the binary representation
+template <class T>
+static inline uint64_t spxHashMix(uint64_t hash, const T& val)
+{
+   using std::isfinite;
+   using std::floor;
+
+   if(val == 0)
+      return spxHashMix(hash, uint64_t(0));
+
+   if(!isfinite(val))
+      return spxHashMix(hash, val > 0 ? uint64_t(1) : uint64_t(2));
+
+   int exp;
+   T mant = spxFrexp(val, &exp);
+
+   hash = spxHashMix(hash, uint64_t(int64_t(exp)));
+
+   for(int k = 0; mant != 0 && k < 64; ++k)
+   {
+      mant *= T(4294967296.0);
+      T chunk = floor(mant);
+      mant -= chunk;
+      hash = spxHashMix(hash, uint64_t(static_cast<long long>(chunk)));
+   }
+
+   return hash;
+}
+
+
+
+/// computes hashes of the rows and columns of the real LP which detect changes since the last sync
+template <class R>
+void SoPlexBase<R>::_hashLPReal(std::vector<uint64_t>& rowSide, std::vector<uint64_t>& rowVec,
+                                std::vector<uint64_t>& col) const
+{
+   const int threads = intParam(SoPlexBase<R>::THREADS);
+
+   rowSide.resize(_realLP->nRows());
+   rowVec.resize(_realLP->nRows());
+   col.resize(_realLP->nCols());
+
+   spxParallelForRange(threads, _realLP->nRows(), [&](int first, int last)
+   {
+      for(int i = first; i < last; ++i)
+      {
+         uint64_t hash = spxHashMix(uint64_t(1), _realLP->lhs(i));
+         hash = spxHashMix(hash, _realLP->rhs(i));
+         rowSide[i] = spxHashMix(hash, _realLP->maxRowObj(i));
+
+         const SVectorBase<R>& vec = _realLP->rowVector(i);
+         hash = spxHashMix(uint64_t(2), uint64_t(vec.size()));
+
+         for(int k = 0; k < vec.size(); ++k)
+         {
+            hash = spxHashMix(hash, uint64_t(vec.index(k)));
+            hash = spxHashMix(hash, vec.value(k));
+         }
+
+         rowVec[i] = hash;
+      }
+   });
+
+   spxParallelForRange(threads, _realLP->nCols(), [&](int first, int last)
+   {
+      for(int j = first; j < last; ++j)
+      {
+         uint64_t hash = spxHashMix(uint64_t(3), _realLP->lower(j));
+         hash = spxHashMix(hash, _realLP->upper(j));
+         col[j] = spxHashMix(hash, _realLP->maxObj(j));
+      }
+   });
+}
+
+
+
+/// converts only the rows and columns of the real LP whose hashes changed since the last sync; returns false if the
+/// rational LP must be copied completely
+template <class R>
+bool SoPlexBase<R>::_updateLPRational(const std::vector<uint64_t>& rowSide,
+                                      const std::vector<uint64_t>& rowVec, const std::vector<uint64_t>& col)
+{
+   const int oldRows = _rationalLP->nRows();
+   const int oldCols = _rationalLP->nCols();
+   const int nRows = _realLP->nRows();
+   const int nCols = _realLP->nCols();
+
+   // rows or columns may have been removed or permuted, or the rational LP was modified otherwise
+   if(nRows < oldRows || nCols < oldCols || int(_syncRowSideHash.size()) != oldRows
+         || int(_syncRowVecHash.size()) != oldRows || int(_syncColHash.size()) != oldCols)
+      return false;
+
+   // converting a large part of the matrix entry by entry is slower than one parallel pass over the whole LP
+   int changedNzos = 0;
+
+   for(int i = 0; i < oldRows; ++i)
+   {
+      if(rowVec[i] != _syncRowVecHash[i])
+         changedNzos += _realLP->rowVector(i).size();
+   }
+
+   for(int i = oldRows; i < nRows; ++i)
+      changedNzos += _realLP->rowVector(i).size();
+
+   for(int j = oldCols; j < nCols; ++j)
+      changedNzos += _realLP->colVector(j).size();
+
+   if(4 * changedNzos > _realLP->nNzos())
+      return false;
+
+   if(int(_rationalLP->spxSense()) != int(_realLP->spxSense()))
+      _rationalLP->changeSense(_realLP->spxSense() == SPxLPBase<R>::MAXIMIZE ? SPxLPRational::MAXIMIZE :
+                               SPxLPRational::MINIMIZE);
+
+   _rationalLP->changeObjOffset(Rational(_realLP->objOffset()));
+
+   // new columns are added with their entries in the old rows, the entries in new rows come with the rows
+   if(nCols > oldCols)
+   {
+      LPColSetRational cols(nCols - oldCols);
+      DSVectorRational vec;
+
+      for(int j = oldCols; j < nCols; ++j)
+      {
+         const SVectorBase<R>& colVec = _realLP->colVector(j);
+         vec.clear();
+
+         for(int k = 0; k < colVec.size(); ++k)
+         {
+            if(colVec.index(k) < oldRows)
+               vec.add(colVec.index(k), Rational(colVec.value(k)));
+         }
+
+         cols.add(Rational(_realLP->obj(j)), Rational(_realLP->lower(j)), vec, Rational(_realLP->upper(j)));
+      }
+
+      _rationalLP->addCols(cols);
+   }
+
+   if(nRows > oldRows)
+   {
+      LPRowSetRational rows(nRows - oldRows);
+
+      for(int i = oldRows; i < nRows; ++i)
+         rows.add(Rational(_realLP->lhs(i)), DSVectorRational(_realLP->rowVector(i)), Rational(_realLP->rhs(i)),
+                  Rational(_realLP->rowObj(i)));
+
+      _rationalLP->addRows(rows);
+   }
+
+   for(int i = 0; i < oldRows; ++i)
+   {
+      if(rowVec[i] != _syncRowVecHash[i])
+      {
+         LPRowRational row(Rational(_realLP->lhs(i)), DSVectorRational(_realLP->rowVector(i)),
+                           Rational(_realLP->rhs(i)), Rational(_realLP->rowObj(i)));
+         _rationalLP->changeRow(i, row);
+      }
+      else if(rowSide[i] != _syncRowSideHash[i])
+      {
+         _rationalLP->changeRange(i, Rational(_realLP->lhs(i)), Rational(_realLP->rhs(i)));
+         _rationalLP->changeRowObj(i, Rational(_realLP->rowObj(i)));
+      }
+   }
+
+   for(int j = 0; j < oldCols; ++j)
+   {
+      if(col[j] != _syncColHash[j])
+      {
+         _rationalLP->changeBounds(j, Rational(_realLP->lower(j)), Rational(_realLP->upper(j)));
+         _rationalLP->changeMaxObj(j, Rational(_realLP->maxObj(j)));
+      }
+   }
+
+   return true;
+}
+
+
+
 /// synchronizes rational solution with R solution, i.e., copies (rounded) rational solution to R solution
 template <class R>
 void SoPlexBase<R>::_syncRealSolution()
@@ -8824,6 +9819,7 @@ SoPlexBase<R>::SoPlexBase()
    _isRealLPLoaded = true;
    _isRealLPScaled = false;
    _applyPolishing = false;
+   _colGenWarmStart = false;
    _optimizeCalls = 0;
    _unscaleCalls = 0;
    _realLP->setOutstream(spxout);
@@ -9627,6 +10623,9 @@ typename SPxSolverBase<R>::Status SoPlexBase<R>::optimize(volatile bool* interru
 
       _solver.setComputeDegenFlag(boolParam(COMPUTEDEGEN));
 
+      if(boolParam(SoPlexBase<R>::AUTOSELECT))
+         _autoSelect();
+
       _optimize(interrupt);
 #ifdef SOPLEX_DEBUG // this check will remove scaling of the realLP
       _checkBasisScaling();
@@ -9668,6 +10667,8 @@ typename SPxSolverBase<R>::Status SoPlexBase<R>::optimize(volatile bool* interru
              printShortStatistics(spxout.getStream(SPxOut::INFO1));
              spxout << "\n");
 
+   // generated columns only affect the solve directly following them
+   _colGenWarmStart = false;
 
    return status();
 }
@@ -9712,6 +10713,146 @@ void SoPlexBase<R>::printShortStatistics(std::ostream& os)
    SPxOut::setScientific(os);
    os << "Objective value     : " << objValueReal() << "\n";
 }
+/// writes checkpoints of the basis and the dual norms to \p filename during floating-point solves, every
+/// CHECKPOINT_ITER iterations and every CHECKPOINT_TIME seconds; a null \p filename disables checkpointing
+template <class R>
+void SoPlexBase<R>::setCheckpointFile(const char* filename)
+{
+   _solver.setCheckpoint(filename, intParam(SoPlexBase<R>::CHECKPOINT_ITER),
+                         realParam(SoPlexBase<R>::CHECKPOINT_TIME));
+}
+
+
+
+/// reads a checkpoint written during an earlier solve of the same LP with the same settings, from which the next
+/// floating-point solve is resumed; returns true on success
+template <class R>
+bool SoPlexBase<R>::readCheckpoint(const char* filename)
+{
+   return _solver.readCheckpoint(filename);
+}
+
+
+
+/// reads a binary warm-start file written by writeWarmStartFile() and sets the starting basis, the dual norms and the
+/// scaling stored in it; returns true on success
+template <class R>
+bool SoPlexBase<R>::readWarmStartFile(const char* filename)
+{
+   SPxCheckpointData data;
+
+   if(!data.readFile(filename))
+      return false;
+
+   if(data.nRows != numRows() || data.nCols != numCols())
+   {
+      MSG_INFO1(spxout, spxout << "Warm-start file <" << filename << "> has " << data.nRows << " rows and "
+                << data.nCols << " columns, but the LP has " << numRows() << " rows and " << numCols()
+                << " columns.\n");
+      return false;
+   }
+
+   DataArray< typename SPxSolverBase<R>::VarStatus > rows(data.nRows);
+   DataArray< typename SPxSolverBase<R>::VarStatus > cols(data.nCols);
+
+   for(int i = 0; i < data.nRows; i++)
+   {
+      if(data.rowStatus[i] < SPxSolverBase<R>::ON_UPPER || data.rowStatus[i] > SPxSolverBase<R>::BASIC)
+         return false;
+
+      rows[i] = typename SPxSolverBase<R>::VarStatus(data.rowStatus[i]);
+   }
+
+   for(int j = 0; j < data.nCols; j++)
+   {
+      if(data.colStatus[j] < SPxSolverBase<R>::ON_UPPER || data.colStatus[j] > SPxSolverBase<R>::BASIC)
+         return false;
+
+      cols[j] = typename SPxSolverBase<R>::VarStatus(data.colStatus[j]);
+   }
+
+   setBasis(rows.get_const_ptr(), cols.get_const_ptr());
+
+   // the dual norms are handed over to the solver, which loads them after setting up the next solve if the simplex
+   // type and representation agree; the norms refer to the scaled LP, hence the scaling is restored as well
+   _warmStartRowScaleExp.swap(data.rowScaleExp);
+   _warmStartColScaleExp.swap(data.colScaleExp);
+
+   if(!data.norms.empty())
+      _solver.setResumeData(data);
+
+   return true;
+}
+
+
+
+/// writes the current basis, the dual norms if available and the scaling exponents of the persistent scaling to a
+/// binary warm-start file; returns true on success
+template <class R>
+bool SoPlexBase<R>::writeWarmStartFile(const char* filename) const
+{
+   if(!hasBasis())
+      return false;
+
+   SPxCheckpointData data;
+
+   data.nRows = numRows();
+   data.nCols = numCols();
+   data.nNzos = numNonzeros();
+   data.type = int(_solver.type());
+   data.rep = int(_solver.rep());
+   data.iteration = numIterations();
+
+   DataArray< typename SPxSolverBase<R>::VarStatus > rows(data.nRows);
+   DataArray< typename SPxSolverBase<R>::VarStatus > cols(data.nCols);
+   getBasis(rows.get_ptr(), cols.get_ptr());
+
+   data.rowStatus.resize(data.nRows);
+   data.colStatus.resize(data.nCols);
+
+   for(int i = 0; i < data.nRows; i++)
+      data.rowStatus[i] = static_cast<signed char>(rows[i]);
+
+   for(int j = 0; j < data.nCols; j++)
+      data.colStatus[j] = static_cast<signed char>(cols[j]);
+
+   // dual norms are only available if the solver holds the original LP
+   if(_isRealLPLoaded)
+   {
+      int nnormsRow;
+      int nnormsCol;
+      _solver.getNdualNorms(nnormsRow, nnormsCol);
+
+      std::vector<R> norms(size_t(nnormsRow) + size_t(nnormsCol));
+
+      if(!norms.empty() && _solver.getDualNorms(nnormsRow, nnormsCol, norms.data()))
+      {
+         data.nNormsRow = nnormsRow;
+         data.nNormsCol = nnormsCol;
+         data.norms.resize(norms.size());
+
+         for(size_t i = 0; i < norms.size(); i++)
+            data.norms[i] = double(norms[i]);
+      }
+   }
+
+   if(_isRealLPLoaded && _realLP->isScaled() && _scaler != nullptr)
+   {
+      data.rowScaleExp.resize(data.nRows);
+      data.colScaleExp.resize(data.nCols);
+
+      for(int i = 0; i < data.nRows; i++)
+         data.rowScaleExp[i] = _scaler->getRowScaleExp(i);
+
+      for(int j = 0; j < data.nCols; j++)
+         data.colScaleExp[j] = _scaler->getColScaleExp(j);
+   }
+
+   return data.writeFile(filename);
+}
+
+
+
 // @todo: temporary fix need to worry about precision
 /// writes basis information to \p filename; if \p rowNames and \p colNames are \c NULL, default names are used;
 /// returns true on success
@@ -9930,6 +11071,22 @@ void SoPlexBase<R>::printSolvingStatistics(std::ostream& os)
 {
    assert(_statistics != 0);
    _statistics->print(os);
+
+   if(_realLP != 0)
+   {
+      SVSetMemStats memStats = _realLP->nzoMemStats();
+
+      if(memStats.fullPacks > 0 || memStats.packSteps > 0)
+      {
+         SPxOut::setFixed(os, 2);
+         os << "Matrix memory       : " << memStats.movedNzos << " nonzeros moved\n"
+            << "  Full compactions  : " << memStats.fullPacks << "\n"
+            << "  Incremental steps : " << memStats.packSteps << "\n"
+            << "  Compaction time   : " << memStats.packTime << " (max " << 1000 * memStats.maxPackTime <<
+            " ms per call)\n"
+            << "  Fragmentation     : " << 100 * memStats.fragmentation() << "% unused\n";
+      }
+   }
 }
 
 
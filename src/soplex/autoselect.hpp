@@ -0,0 +1,322 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#include <algorithm>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <assert.h>
+
+#include "soplex/spxdefines.h"
+#include "soplex.h"
+
+/* This file contains the automatic choice of representation, algorithm, pricer and ratio tester
+ *
+ * Each decision is a threshold rule on one feature of the LP: the row representation is used if the ratio of rows to
+ * columns exceeds REPRESENTATION_SWITCH, the dual simplex if the fraction of rows violated at the starting point
+ * exceeds AUTOSELECT_PRIMAL, steepest edge pricing if the fraction of rows with activity at a side (a degeneracy
+ * estimate for the slack basis) exceeds AUTOSELECT_STEEP, and the bound flipping ratio test if the fraction of boxed
+ * columns exceeds AUTOSELECT_BOUNDFLIP.  The thresholds can be learned from timings on a set of LPs by
+ * calibrateAutoSelect(). */
+
+namespace soplex
+{
+
+/// computes the features of the real LP
+template <class R>
+void SoPlexBase<R>::getLPFeaturesReal(LPFeatures& features) const
+{
+   const int nrows = numRows();
+   const int ncols = numCols();
+   const R infinity = realParam(SoPlexBase<R>::INFTY);
+   const R feastol = realParam(SoPlexBase<R>::FEASTOL);
+
+   features = LPFeatures();
+   features.nRows = nrows;
+   features.nCols = ncols;
+   features.nNonzeros = numNonzeros();
+   features.aspectRatio = Real(nrows + 1) / Real(ncols + 1);
+
+   if(nrows > 0 && ncols > 0)
+      features.density = Real(features.nNonzeros) / (Real(nrows) * Real(ncols));
+
+   // compute the activities at the starting point
+   VectorBase<R> activity(nrows);
+   activity.clear();
+
+   for(int j = 0; j < ncols; ++j)
+   {
+      const R lower = _realLP->lower(j);
+      const R upper = _realLP->upper(j);
+      R x = 0.0;
+
+      if(lower > -infinity && upper < infinity)
+      {
+         features.boxedCols += 1;
+         x = (spxAbs(lower) <= spxAbs(upper)) ? lower : upper;
+      }
+      else if(lower > -infinity)
+         x = lower;
+      else if(upper < infinity)
+         x = upper;
+      else
+         features.freeCols += 1;
+
+      if(x != 0.0)
+      {
+         const SVectorBase<R>& col = _realLP->colVector(j);
+
+         for(int k = 0; k < col.size(); ++k)
+            activity[col.index(k)] += x * col.value(k);
+      }
+   }
+
+   for(int i = 0; i < nrows; ++i)
+   {
+      const R lhs = _realLP->lhs(i);
+      const R rhs = _realLP->rhs(i);
+
+      if(lhs == rhs)
+         features.equalityRows += 1;
+      else if(lhs > -infinity && rhs < infinity)
+         features.rangedRows += 1;
+
+      if((lhs > -infinity && activity[i] < lhs - feastol) || (rhs < infinity && activity[i] > rhs + feastol))
+         features.infeasibleRows += 1;
+      else if((lhs > -infinity && activity[i] <= lhs + feastol) || (rhs < infinity && activity[i] >= rhs - feastol))
+         features.degenerateRows += 1;
+   }
+
+   if(ncols > 0)
+   {
+      features.boxedCols /= ncols;
+      features.freeCols /= ncols;
+   }
+
+   if(nrows > 0)
+   {
+      features.equalityRows /= nrows;
+      features.rangedRows /= nrows;
+      features.infeasibleRows /= nrows;
+      features.degenerateRows /= nrows;
+   }
+}
+
+
+
+/// sets representation, algorithm, pricer and ratio tester according to the features of the real LP
+template <class R>
+void SoPlexBase<R>::_autoSelect()
+{
+   LPFeatures features;
+   getLPFeaturesReal(features);
+
+   const int representation = (features.aspectRatio > realParam(SoPlexBase<R>::REPRESENTATION_SWITCH))
+                              ? REPRESENTATION_ROW : REPRESENTATION_COLUMN;
+   const int algorithm = (features.infeasibleRows > realParam(SoPlexBase<R>::AUTOSELECT_PRIMAL))
+                         ? ALGORITHM_DUAL : ALGORITHM_PRIMAL;
+   const int pricer = (features.degenerateRows > realParam(SoPlexBase<R>::AUTOSELECT_STEEP))
+                      ? PRICER_STEEP : PRICER_DEVEX;
+   const int ratiotester = (features.boxedCols > realParam(SoPlexBase<R>::AUTOSELECT_BOUNDFLIP))
+                           ? RATIOTESTER_BOUNDFLIPPING : RATIOTESTER_FAST;
+
+   MSG_INFO1(spxout, spxout << std::fixed << std::setprecision(3)
+             << "Automatic selection: density " << features.density
+             << ", aspect ratio " << features.aspectRatio
+             << ", boxed " << features.boxedCols
+             << ", infeasible " << features.infeasibleRows
+             << ", degenerate " << features.degenerateRows << " -> "
+             << (representation == REPRESENTATION_ROW ? "row" : "column") << " representation, "
+             << (algorithm == ALGORITHM_PRIMAL ? "primal" : "dual") << " simplex, "
+             << (pricer == PRICER_STEEP ? "steep" : "devex") << " pricing, "
+             << (ratiotester == RATIOTESTER_BOUNDFLIPPING ? "boundflipping" : "fast") << " ratio test\n\n");
+
+   setIntParam(SoPlexBase<R>::REPRESENTATION, representation);
+   setIntParam(SoPlexBase<R>::ALGORITHM, algorithm);
+   setIntParam(SoPlexBase<R>::PRICER, pricer);
+   setIntParam(SoPlexBase<R>::RATIOTESTER, ratiotester);
+}
+
+
+
+/// returns the threshold minimizing the total time if the instances with feature value above the threshold take
+/// timeAbove and the others timeBelow; ties are broken towards current
+template <class R>
+Real SoPlexBase<R>::_learnThreshold(const std::vector<Real>& feature, const std::vector<Real>& timeBelow,
+                                    const std::vector<Real>& timeAbove, Real current, Real lower)
+{
+   assert(feature.size() == timeBelow.size());
+   assert(feature.size() == timeAbove.size());
+
+   // candidates are the lower bound, the midpoints between consecutive feature values, and the largest value
+   std::vector<Real> values(feature);
+   std::sort(values.begin(), values.end());
+   values.erase(std::unique(values.begin(), values.end()), values.end());
+
+   std::vector<Real> candidates(1, lower);
+
+   for(size_t k = 0; k + 1 < values.size(); ++k)
+      candidates.push_back(0.5 * (values[k] + values[k + 1]));
+
+   if(!values.empty())
+      candidates.push_back(values.back());
+
+   Real best = current;
+   Real bestTime = Real(infinity);
+
+   for(Real threshold : candidates)
+   {
+      threshold = MAXIMUM(threshold, lower);
+      Real time = 0.0;
+
+      for(size_t i = 0; i < feature.size(); ++i)
+         time += (feature[i] > threshold) ? timeAbove[i] : timeBelow[i];
+
+      if(time < bestTime || (time == bestTime && spxAbs(threshold - current) < spxAbs(best - current)))
+      {
+         best = threshold;
+         bestTime = time;
+      }
+   }
+
+   return best;
+}
+
+
+
+/// learns the thresholds of the automatic selection from timings of the LPs in filenames
+template <class R>
+bool SoPlexBase<R>::calibrateAutoSelect(const std::vector<std::string>& filenames)
+{
+   // every decision sets an integer parameter to one of two values depending on a feature and a threshold
+   const int ndecisions = 4;
+   const IntParam decisionParam[ndecisions] = { REPRESENTATION, ALGORITHM, PRICER, RATIOTESTER };
+   const RealParam decisionThreshold[ndecisions] = { REPRESENTATION_SWITCH, AUTOSELECT_PRIMAL, AUTOSELECT_STEEP,
+                                                     AUTOSELECT_BOUNDFLIP
+                                                   };
+   const int decisionBelow[ndecisions] = { REPRESENTATION_COLUMN, ALGORITHM_PRIMAL, PRICER_DEVEX, RATIOTESTER_FAST };
+   const int decisionAbove[ndecisions] = { REPRESENTATION_ROW, ALGORITHM_DUAL, PRICER_STEEP, RATIOTESTER_BOUNDFLIPPING };
+   const char* decisionName[ndecisions] = { "representation", "algorithm", "pricer", "ratiotester" };
+
+   std::vector<Real> feature[ndecisions];
+   std::vector<Real> timeBelow[ndecisions];
+   std::vector<Real> timeAbove[ndecisions];
+
+   MSG_INFO1(spxout, spxout << "Calibrating automatic selection on " << filenames.size() << " LPs . . .\n\n"
+             << std::setw(24) << std::left << "LP" << std::right);
+
+   for(int d = 0; d < ndecisions; ++d)
+      MSG_INFO1(spxout, spxout << " | " << std::setw(22) << decisionName[d]);
+
+   MSG_INFO1(spxout, spxout << "\n");
+
+   for(const std::string& filename : filenames)
+   {
+      LPFeatures features;
+      Real times[ndecisions][2];
+      bool success = true;
+
+      for(int d = 0; d < ndecisions && success; ++d)
+      {
+         for(int above = 0; above < 2 && success; ++above)
+         {
+            // copy the current parameters, but solve quietly and measure wall-clock time
+            SoPlexBase<R> lpsolver;
+            lpsolver.setIntParam(SoPlexBase<R>::VERBOSITY, SPxOut::ERROR);
+            lpsolver._changeParams(*_currentSettings);
+            lpsolver.setBoolParam(SoPlexBase<R>::AUTOSELECT, false);
+            lpsolver.setIntParam(SoPlexBase<R>::TIMER, TIMER_WALLCLOCK);
+            lpsolver.setTimings(Timer::WALLCLOCK_TIME);
+            lpsolver.setIntParam(decisionParam[d], above ? decisionAbove[d] : decisionBelow[d]);
+
+            if(!lpsolver.readFile(filename.c_str()))
+            {
+               MSG_WARNING(spxout, spxout << "Could not read LP file <" << filename << "> - skipping\n");
+               success = false;
+               break;
+            }
+
+            if(d == 0 && above == 0)
+               lpsolver.getLPFeaturesReal(features);
+
+            const typename SPxSolverBase<R>::Status status = lpsolver.optimize();
+
+            // unsolved LPs count with the time limit, or ten times the time spent if there is no time limit
+            times[d][above] = lpsolver.solveTime();
+
+            if(status != SPxSolverBase<R>::OPTIMAL && status != SPxSolverBase<R>::INFEASIBLE
+                  && status != SPxSolverBase<R>::UNBOUNDED && status != SPxSolverBase<R>::INForUNBD)
+               times[d][above] = (realParam(SoPlexBase<R>::TIMELIMIT) < realParam(SoPlexBase<R>::INFTY))
+                                 ? Real(realParam(SoPlexBase<R>::TIMELIMIT)) : 10.0 * times[d][above];
+         }
+      }
+
+      if(!success)
+         continue;
+
+      const Real featureValue[ndecisions] = { features.aspectRatio, features.infeasibleRows, features.degenerateRows,
+                                              features.boxedCols
+                                            };
+
+      MSG_INFO1(spxout, spxout << std::setw(24) << std::left
+                << filename.substr(filename.find_last_of('/') == std::string::npos ? 0 : filename.find_last_of('/') + 1)
+                << std::right << std::fixed << std::setprecision(4));
+
+      for(int d = 0; d < ndecisions; ++d)
+      {
+         feature[d].push_back(featureValue[d]);
+         timeBelow[d].push_back(times[d][0]);
+         timeAbove[d].push_back(times[d][1]);
+
+         MSG_INFO1(spxout, spxout << " | " << std::setw(6) << std::setprecision(3) << featureValue[d] << std::setprecision(4)
+                   << std::setw(8) << times[d][0] << std::setw(8) << times[d][1]);
+      }
+
+      MSG_INFO1(spxout, spxout << "\n");
+   }
+
+   MSG_INFO1(spxout, spxout << std::defaultfloat << "\n");
+
+   if(feature[0].empty())
+      return false;
+
+   for(int d = 0; d < ndecisions; ++d)
+   {
+      const RealParam param = decisionThreshold[d];
+      const Real threshold = _learnThreshold(feature[d], timeBelow[d], timeAbove[d], realParam(param),
+                                             _currentSettings->realParam.lower[param]);
+
+      setRealParam(param, MINIMUM(threshold, Real(_currentSettings->realParam.upper[param])));
+
+      MSG_INFO1(spxout, spxout << "real:" << _currentSettings->realParam.name[param] << " = " << realParam(param)
+                << "\n");
+   }
+
+   MSG_INFO1(spxout, spxout << "\n");
+
+   return true;
+}
+
+} // namespace soplex
@@ -886,6 +886,23 @@ void SPxSolverBase<R>::changeElement(int i, int j, const R& val, bool scale)
    unInit();
 }
 
+template <class R>
+void SPxSolverBase<R>::changeElements(int n, const int rows[], const int cols[], const R vals[], bool scale)
+{
+   if(n <= 0)
+      return;
+
+   forceRecompNonbasicValue();
+
+   SPxLPBase<R>::changeElements(n, rows, cols, vals, scale);
+
+   // changedElement() resets the basis regardless of the element, hence it is called only once
+   if(SPxBasisBase<R>::status() > SPxBasisBase<R>::NO_PROBLEM)
+      SPxBasisBase<R>::changedElement(rows[0], cols[0]);
+
+   unInit();
+}
+
 template <class R>
 void SPxSolverBase<R>::changeSense(typename SPxLPBase<R>::SPxSense sns)
 {
@@ -1424,6 +1424,7 @@ bool SPxSolverBase<R>::enter(SPxId& enterId, bool polish)
       //  process entering variable
       theUBbound[leaveIdx] = enterUB;
       theLBbound[leaveIdx] = enterLB;
+      moveShifted(leaveIdx, enterId);
 
       //  compute tests:
       updateCoTest();
@@ -0,0 +1 @@
+#define SPX_GITHASH "51d0eef-dirty"
@@ -562,6 +562,18 @@ public:
       SVSetBase<R>::memPack();
    }
 
+   /// Sets the maximum number of nonzeros moved by one incremental compaction step of the nonzero memory.
+   void setMemPackSlice(int slice)
+   {
+      SVSetBase<R>::setMemPackSlice(slice);
+   }
+
+   /// Returns the statistics of the compaction of the nonzero memory.
+   SVSetMemStats memStats() const
+   {
+      return SVSetBase<R>::memStats();
+   }
+
    ///@}
 
    // ------------------------------------------------------------------------------------------------------------------
@@ -641,6 +653,25 @@ public:
       return *this;
    }
 
+   /// Assigns \p rs, converting its values on up to \p threads threads.
+   template < class S >
+   void assign(const LPColSetBase<S>& rs, int threads)
+   {
+      if(this == (const LPColSetBase<R>*)(&rs))
+         return;
+
+      SVSetBase<R>::assign(rs, threads);
+      low.reDim(rs.low.dim(), false);
+      spxParallelConvert(threads, low.dim(), low, rs.low);
+      up.reDim(rs.up.dim(), false);
+      spxParallelConvert(threads, up.dim(), up, rs.up);
+      object.reDim(rs.object.dim(), false);
+      spxParallelConvert(threads, object.dim(), object, rs.object);
+      scaleExp = rs.scaleExp;
+
+      assert(isConsistent());
+   }
+
    /// Copy constructor.
    LPColSetBase<R>(const LPColSetBase<R>& rs)
       : SVSetBase<R>(rs)
@@ -652,6 +652,18 @@ public:
       SVSetBase<R>::memPack();
    }
 
+   /// Sets the maximum number of nonzeros moved by one incremental compaction step of the nonzero memory.
+   void setMemPackSlice(int slice)
+   {
+      SVSetBase<R>::setMemPackSlice(slice);
+   }
+
+   /// Returns the statistics of the compaction of the nonzero memory.
+   SVSetMemStats memStats() const
+   {
+      return SVSetBase<R>::memStats();
+   }
+
    ///@}
 
    // ------------------------------------------------------------------------------------------------------------------
@@ -731,6 +743,25 @@ public:
       return *this;
    }
 
+   /// Assigns \p rs, converting its values on up to \p threads threads.
+   template < class S >
+   void assign(const LPRowSetBase<S>& rs, int threads)
+   {
+      if(this == (const LPRowSetBase<R>*)(&rs))
+         return;
+
+      SVSetBase<R>::assign(rs, threads);
+      left.reDim(rs.left.dim(), false);
+      spxParallelConvert(threads, left.dim(), left, rs.left);
+      right.reDim(rs.right.dim(), false);
+      spxParallelConvert(threads, right.dim(), right, rs.right);
+      object.reDim(rs.object.dim(), false);
+      spxParallelConvert(threads, object.dim(), object, rs.object);
+      scaleExp = rs.scaleExp;
+
+      assert(isConsistent());
+   }
+
    /// Copy constructor.
    LPRowSetBase<R>(const LPRowSetBase<R>& rs)
       : SVSetBase<R>(rs)
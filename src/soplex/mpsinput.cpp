@@ -63,12 +63,44 @@ static void patch_field(char* buf, int beg, int end)
          buf[i] = PATCH_CHAR;
 }
 
+/// split \p buf into fields separated by blanks like strtok, but keep the position in \p save instead of a static
+/// variable, such that several MPS files can be read concurrently.
+static char* next_field(char* buf, char*& save)
+{
+   char* field = (buf != 0) ? buf : save;
+
+   if(field == 0)
+      return 0;
+
+   while(*field == BLANK)
+      field++;
+
+   if(*field == '\0')
+   {
+      save = field;
+      return 0;
+   }
+
+   char* end = field;
+
+   while(*end != '\0' && *end != BLANK)
+      end++;
+
+   if(*end != '\0')
+      *end++ = '\0';
+
+   save = end;
+
+   return field;
+}
+
 /// read a MPS format data line and parse the fields.
 bool MPSInput::readLine()
 {
    int   len;
    int   space;
    char* s;
+   char* save = 0;
    bool  is_marker;
    bool  is_comment;
 
@@ -118,11 +150,11 @@ bool MPSInput::readLine()
        */
       if(*m_buf != BLANK)
       {
-         m_f0 = strtok(&m_buf[0], " ");
+         m_f0 = next_field(&m_buf[0], save);
 
          assert(m_f0 != 0);
 
-         m_f1 = strtok(0, " ");
+         m_f1 = next_field(0, save);
 
          return true;
       }
@@ -194,10 +226,10 @@ bool MPSInput::readLine()
        */
       do
       {
-         if(0 == (m_f1 = strtok(s, " ")))
+         if(0 == (m_f1 = next_field(s, save)))
             break;
 
-         if((0 == (m_f2 = strtok(0, " "))) || (*m_f2 == '$'))
+         if((0 == (m_f2 = next_field(0, save))) || (*m_f2 == '$'))
          {
             m_f2 = 0;
             break;
@@ -206,7 +238,7 @@ bool MPSInput::readLine()
          if(!strcmp(m_f2, "'MARKER'"))
             is_marker = true;
 
-         if((0 == (m_f3 = strtok(0, " "))) || (*m_f3 == '$'))
+         if((0 == (m_f3 = next_field(0, save))) || (*m_f3 == '$'))
          {
             m_f3 = 0;
             break;
@@ -225,7 +257,7 @@ bool MPSInput::readLine()
          if(!strcmp(m_f3, "'MARKER'"))
             is_marker = true;
 
-         if((0 == (m_f4 = strtok(0, " "))) || (*m_f4 == '$'))
+         if((0 == (m_f4 = next_field(0, save))) || (*m_f4 == '$'))
          {
             m_f4 = 0;
             break;
@@ -241,7 +273,7 @@ bool MPSInput::readLine()
                break; // unknown marker
          }
 
-         if((0 == (m_f5 = strtok(0, " "))) || (*m_f5 == '$'))
+         if((0 == (m_f5 = next_field(0, save))) || (*m_f5 == '$'))
             m_f5 = 0;
       }
       while(false);
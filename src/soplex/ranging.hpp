@@ -0,0 +1,381 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <assert.h>
+
+#include "soplex/spxdefines.h"
+#include "soplex.h"
+#include "soplex/spxthreads.h"
+
+#define RANGING_SOLVESPERTHREAD  16   /**< minimum number of solves with the basis matrix per thread */
+
+/* This file contains the sensitivity analysis of an optimal basis of the real LP
+ *
+ * The ranges are computed on the unscaled real LP in the formulation A x - s = 0, lhs <= s <= rhs, lower <= x <= upper,
+ * independently of the representation and scaling used by the solver.  The basis matrix B consists of the basic columns
+ * of [A -I] and is factorized once.  The range of the objective coefficient of a basic column needs one solve with B^T,
+ * the range of the active side of a nonbasic row one solve with B; all other ranges follow directly from the solution.
+ * The solves are independent and distributed over the threads, where every thread except the first works on its own
+ * copy of the factorization. */
+
+namespace soplex
+{
+
+/// computes the ranges of the objective coefficients and of the active sides in which the current basis stays optimal
+template <class R>
+bool SoPlexBase<R>::getRangingReal(VectorBase<R>& objLower, VectorBase<R>& objUpper,
+                                   VectorBase<R>& sideLower, VectorBase<R>& sideUpper)
+{
+   if(!hasSol() || !hasBasis() || status() != SPxSolverBase<R>::OPTIMAL
+         || objLower.dim() < numCols() || objUpper.dim() < numCols()
+         || sideLower.dim() < numRows() || sideUpper.dim() < numRows())
+      return false;
+
+   _syncRealSolution();
+
+   if(!_solReal.isPrimalFeasible() || !_solReal.isDualFeasible())
+      return false;
+
+   const int nrows = numRows();
+   const int ncols = numCols();
+   const R infinity = realParam(SoPlexBase<R>::INFTY);
+   const R eps = realParam(SoPlexBase<R>::EPSILON_ZERO);
+   const R sense = (intParam(SoPlexBase<R>::OBJSENSE) == OBJSENSE_MINIMIZE) ? 1.0 : -1.0;
+
+   const VectorBase<R>& primal = _solReal._primal;
+   const VectorBase<R>& slacks = _solReal._slacks;
+   const VectorBase<R>& dual = _solReal._dual;
+   const VectorBase<R>& redCost = _solReal._redCost;
+
+   SPxLPBase<R> lp(*_realLP);
+
+   if(lp.isScaled())
+   {
+      assert(_scaler != 0);
+      _scaler->unscale(lp);
+   }
+
+   DataArray< typename SPxSolverBase<R>::VarStatus > rowStatus(nrows);
+   DataArray< typename SPxSolverBase<R>::VarStatus > colStatus(ncols);
+   getBasis(rowStatus.get_ptr(), colStatus.get_ptr());
+
+   // position of the basic columns in the basis matrix
+   SLUFactor<R> factor;
+   std::vector<int> basicVar;
+   std::vector<int> colPos(ncols, -1);
+
+   if(!_factorizeBasisMatrix(lp, rowStatus.get_ptr(), colStatus.get_ptr(), factor, basicVar))
+   {
+      MSG_INFO1(spxout, spxout << "Ranging failed: basis matrix is singular.\n");
+      return false;
+   }
+
+   for(int r = 0; r < nrows; r++)
+   {
+      if(basicVar[r] >= 0)
+         colPos[basicVar[r]] = r;
+   }
+
+   // ranges that follow directly from the solution: objective coefficients of nonbasic columns, where only the reduced
+   // cost of the column itself changes, and sides of basic rows, which are limited by the activity of the row
+   for(int j = 0; j < ncols; j++)
+   {
+      R lower = -infinity;
+      R upper = infinity;
+
+      switch(colStatus[j])
+      {
+      case SPxSolverBase<R>::ON_LOWER:
+         if(sense > 0)
+            lower = lp.obj(j) - redCost[j];
+         else
+            upper = lp.obj(j) - redCost[j];
+
+         break;
+
+      case SPxSolverBase<R>::ON_UPPER:
+         if(sense > 0)
+            upper = lp.obj(j) - redCost[j];
+         else
+            lower = lp.obj(j) - redCost[j];
+
+         break;
+
+      case SPxSolverBase<R>::ZERO:
+         lower = lp.obj(j) - redCost[j];
+         upper = lower;
+         break;
+
+      default:
+         break;
+      }
+
+      objLower[j] = lower;
+      objUpper[j] = upper;
+   }
+
+   for(int i = 0; i < nrows; i++)
+   {
+      sideLower[i] = -infinity;
+      sideUpper[i] = infinity;
+
+      if(rowStatus[i] == SPxSolverBase<R>::BASIC)
+      {
+         if(lp.rhs(i) < infinity)
+            sideLower[i] = slacks[i];
+         else if(lp.lhs(i) > -infinity)
+            sideUpper[i] = slacks[i];
+      }
+   }
+
+   // the remaining ranges need one solve each, where a nonnegative task denotes a basic column and a negative task
+   // -1-i the nonbasic row i
+   std::vector<int> tasks;
+
+   for(int j = 0; j < ncols; j++)
+   {
+      if(colStatus[j] == SPxSolverBase<R>::BASIC)
+         tasks.push_back(j);
+   }
+
+   for(int i = 0; i < nrows; i++)
+   {
+      if(rowStatus[i] != SPxSolverBase<R>::BASIC && rowStatus[i] != SPxSolverBase<R>::ZERO)
+         tasks.push_back(-1 - i);
+   }
+
+   const int ntasks = int(tasks.size());
+
+   if(ntasks == 0)
+      return true;
+
+   // restricts the range [lower, upper] of the change delta of an objective coefficient such that the reduced cost
+   // sense * (redcost - delta * alpha) = t - delta * g of a nonbasic variable with the given status keeps its sign
+   auto restrictObj = [&](typename SPxSolverBase<R>::VarStatus varStatus, R t, R g, R & lower, R & upper)
+   {
+      if(spxAbs(g) <= eps)
+         return;
+
+      switch(varStatus)
+      {
+      case SPxSolverBase<R>::ON_LOWER:
+         t = MAXIMUM(t, R(0.0));
+
+         if(g > 0)
+            upper = MINIMUM(upper, t / g);
+         else
+            lower = MAXIMUM(lower, t / g);
+
+         break;
+
+      case SPxSolverBase<R>::ON_UPPER:
+         t = MINIMUM(t, R(0.0));
+
+         if(g > 0)
+            lower = MAXIMUM(lower, t / g);
+         else
+            upper = MINIMUM(upper, t / g);
+
+         break;
+
+      case SPxSolverBase<R>::ZERO:
+         lower = MAXIMUM(lower, R(0.0));
+         upper = MINIMUM(upper, R(0.0));
+         break;
+
+      default:
+         break;
+      }
+   };
+
+   // restricts the range [lower, upper] of the change delta of a side such that the basic variable with value x and
+   // bounds varLower and varUpper, which changes by delta * beta, stays within its bounds
+   auto restrictSide = [&](R x, R varLower, R varUpper, R beta, R & lower, R & upper)
+   {
+      if(spxAbs(beta) <= eps)
+         return;
+
+      if(varUpper < infinity)
+      {
+         R room = MAXIMUM(varUpper - x, R(0.0));
+
+         if(beta > 0)
+            upper = MINIMUM(upper, room / beta);
+         else
+            lower = MAXIMUM(lower, room / beta);
+      }
+
+      if(varLower > -infinity)
+      {
+         R room = MINIMUM(varLower - x, R(0.0));
+
+         if(beta > 0)
+            lower = MAXIMUM(lower, room / beta);
+         else
+            upper = MINIMUM(upper, room / beta);
+      }
+   };
+
+   auto solveRange = [&](SLinSolver<R>* solver, int first, int last)
+   {
+      SSVectorBase<R> work(nrows);
+      DSVectorBase<R> unit(1);
+      VectorBase<R> alpha(ncols);
+      std::vector<int> touched;
+      std::vector<bool> isTouched(ncols, false);
+
+      for(int k = first; k < last; k++)
+      {
+         R lower = -infinity;
+         R upper = infinity;
+
+         if(tasks[k] >= 0)
+         {
+            // a change delta of the objective coefficient of basic column j at position r changes the duals by
+            // delta * rho with rho^T = e_r^T B^-1 and the reduced costs of the nonbasic variables by -delta * rho^T a
+            const int j = tasks[k];
+
+            unit.clear();
+            unit.add(colPos[j], 1.0);
+            solver->solveLeft(work, unit);
+
+            if(!work.isSetup())
+               work.setup();
+
+            for(int n = 0; n < work.size(); n++)
+            {
+               const int i = work.index(n);
+               const R rho = work[i];
+               const SVectorBase<R>& rowVector = lp.rowVector(i);
+
+               for(int l = 0; l < rowVector.size(); l++)
+               {
+                  const int c = rowVector.index(l);
+
+                  if(!isTouched[c])
+                  {
+                     isTouched[c] = true;
+                     touched.push_back(c);
+                  }
+
+                  alpha[c] += rho * rowVector.value(l);
+               }
+
+               if(rowStatus[i] != SPxSolverBase<R>::BASIC)
+                  restrictObj(rowStatus[i], sense * dual[i], -sense * rho, lower, upper);
+            }
+
+            for(int c : touched)
+            {
+               if(colStatus[c] != SPxSolverBase<R>::BASIC)
+                  restrictObj(colStatus[c], sense * redCost[c], sense * alpha[c], lower, upper);
+
+               alpha[c] = 0;
+               isTouched[c] = false;
+            }
+
+            touched.clear();
+
+            objLower[j] = (lower <= -infinity) ? -infinity : lp.obj(j) + lower;
+            objUpper[j] = (upper >= infinity) ? infinity : lp.obj(j) + upper;
+         }
+         else
+         {
+            // a change delta of the active side of nonbasic row i changes its slack by delta and the basic variables
+            // by delta * beta with beta = B^-1 e_i
+            const int i = -1 - tasks[k];
+
+            unit.clear();
+            unit.add(i, 1.0);
+            solver->solveRight(work, unit);
+
+            if(!work.isSetup())
+               work.setup();
+
+            for(int n = 0; n < work.size(); n++)
+            {
+               const int r = work.index(n);
+               const int var = basicVar[r];
+
+               if(var >= 0)
+                  restrictSide(primal[var], lp.lower(var), lp.upper(var), work[r], lower, upper);
+               else
+                  restrictSide(slacks[-1 - var], lp.lhs(-1 - var), lp.rhs(-1 - var), work[r], lower, upper);
+            }
+
+            R side;
+
+            if(rowStatus[i] == SPxSolverBase<R>::ON_LOWER)
+            {
+               side = lp.lhs(i);
+
+               if(lp.rhs(i) < infinity)
+                  upper = MINIMUM(upper, lp.rhs(i) - lp.lhs(i));
+            }
+            else if(rowStatus[i] == SPxSolverBase<R>::ON_UPPER)
+            {
+               side = lp.rhs(i);
+
+               if(lp.lhs(i) > -infinity)
+                  lower = MAXIMUM(lower, lp.lhs(i) - lp.rhs(i));
+            }
+            else
+            {
+               assert(rowStatus[i] == SPxSolverBase<R>::FIXED);
+               side = lp.rhs(i);
+            }
+
+            sideLower[i] = (lower <= -infinity) ? -infinity : side + lower;
+            sideUpper[i] = (upper >= infinity) ? infinity : side + upper;
+         }
+      }
+   };
+
+   const int nranges = MINIMUM(intParam(SoPlexBase<R>::THREADS), (ntasks - 1) / RANGING_SOLVESPERTHREAD + 1);
+   std::vector<std::unique_ptr<SLinSolver<R>>> factors(nranges);
+
+   for(int t = 1; t < nranges; t++)
+      factors[t].reset(factor.clone());
+
+   try
+   {
+      spxParallelFor(nranges, nranges, [&](int t)
+      {
+         solveRange(t == 0 ? &factor : factors[t].get(), (int)((long long) ntasks * t / nranges),
+                    (int)((long long) ntasks * (t + 1) / nranges));
+      });
+   }
+   catch(const SPxException& E)
+   {
+      MSG_INFO1(spxout, spxout << "Ranging failed: caught exception <" << E.what() << "> while solving with the basis.\n");
+      return false;
+   }
+
+   return true;
+}
+
+} // namespace soplex
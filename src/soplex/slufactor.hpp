@@ -883,6 +883,9 @@ void SLUFactor<R>::assign(const SLUFactor<R>& old)
 
    this->diag = old.diag;
 
+   // the temporary vectors are not copied, but they must have the dimension of the factorization for solves
+   vec.reDim(this->thedim);
+   ssvec.reDim(this->thedim);
    this->work = vec.get_ptr();
 
    /* setup U
@@ -997,7 +1000,7 @@ void SLUFactor<R>::assign(const SLUFactor<R>& old)
    memcpy(this->l.start, old.l.start, (unsigned int)this->l.startSize * sizeof(*this->l.start));
    memcpy(this->l.row,   old.l.row, (unsigned int)this->l.startSize * sizeof(*this->l.row));
 
-   if(!this->l.rval.empty())
+   if(!old.l.rval.empty())
    {
       assert(old.l.ridx  != 0);
       assert(old.l.rbeg  != 0);
@@ -23,12 +23,15 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 #include <iostream>
+#include <memory>
+#include <vector>
 #include <assert.h>
 
 #include "soplex/spxdefines.h"
 #include "soplex.h"
 #include "soplex/statistics.h"
 #include "soplex/sorter.h"
+#include "soplex/spxthreads.h"
 
 //#define NO_TOL
 #define USE_FEASTOL
@@ -39,6 +42,7 @@
 #define DEGENCHECK_OFFSET  50    /**< the number of iteration before the degeneracy check is reperformed */
 #define SLACKCOEFF         1.0   /**< the coefficient of the slack variable in the incompatible rows. */
 #define TIMELIMIT_FRAC     0.5   /**< the fraction of the total time limit given to the setup of the reduced problem */
+#define SOLVEROWS_PERTHREAD 64   /**< the minimum number of row solves assigned to each thread of the compatibility computation */
 
 /* This file contains the private functions for the Decomposition Based Dual Simplex (DBDS)
  *
@@ -370,7 +374,9 @@ void SoPlexBase<R>::_solveDecompositionDualSimplex()
       {
          //_compSolver.writeFileLPBase("comp.lp");
 
-         _decompSimplifyAndSolve(_compSolver, _compSlufactor, true, true);
+         // as for the reduced problem, only the first complementary problem is preprocessed and solved from scratch;
+         // afterwards, the complementary problem is updated in place and resolved starting from its previous basis
+         _decompSimplifyAndSolve(_compSolver, _compSlufactor, !algIterCount, !algIterCount);
 
          MSG_INFO2(spxout, spxout << "Iteration " << algIterCount
                    << "Objective Value: " << std::setprecision(10) << _compSolver.objValue()
@@ -1169,9 +1175,9 @@ void SoPlexBase<R>::_decompResolveWithoutPreprocessing(SPxSolverBase<R>& solver,
 
 /// updates the reduced problem with additional rows using the solution to the complementary problem
 template <class R>
-void SoPlexBase<R>::_updateDecompReducedProblem(R objValue, VectorBase<R> dualVector,
-      VectorBase<R> redcostVector,
-      VectorBase<R> compPrimalVector, VectorBase<R> compDualVector)
+void SoPlexBase<R>::_updateDecompReducedProblem(R objValue, const VectorBase<R>& dualVector,
+      const VectorBase<R>& redcostVector,
+      const VectorBase<R>& compPrimalVector, const VectorBase<R>& compDualVector)
 {
    R feastol = realParam(SoPlexBase<R>::FEASTOL);
 
@@ -1271,8 +1277,6 @@ void SoPlexBase<R>::_updateDecompReducedProblem(R objValue, VectorBase<R> dualVe
    //ratioTest = false;
    for(int i = 0; i < _nPrimalRows; i++)
    {
-      LPRowBase<R> origlprow;
-      DSVectorBase<R> rowtoaddVec(_realLP->nCols());
       R compProbPrimal = 0;
       R compRowRedcost = 0;
       int rownumber = _realLP->number(SPxRowId(_decompPrimalRowIDs[i]));
@@ -1405,36 +1409,26 @@ void SoPlexBase<R>::_updateDecompReducedProblemViol(bool allrows)
    if(allrows)
       nrowstoadd = _nDecompViolRows;   // adding all violated rows
 
-   SSVectorBase<R>  y(_solver.nCols());
-   y.unSetup();
+   // the row norms of the violated rows are computed in parallel, the rows are selected sequentially afterwards
+   std::vector<R> rownorms;
 
-   // identifying the rows not included in the reduced problem that are violated by the current solution.
-   for(int i = 0; i < nrowstoadd; i++)
+   if(!allrows)
    {
-      rowNumber = _decompViolatedRows[i];
+      rownorms.resize(nrowstoadd);
 
-      if(!allrows)
+      // the rhs of this calculation are the rows of the constraint matrix
+      // so we are solving y B = A_{i,.}
+      _solveDecompRows(_decompViolatedRows, nrowstoadd, [&](int k,
+                       const SSVectorBase<R>& y)
       {
          R norm = 0;
 
-         // the rhs of this calculation are the rows of the constraint matrix
-         // so we are solving y B = A_{i,.}
-         try
-         {
-            _solver.basis().solve(y, _solver.vector(rowNumber));
-         }
-         catch(const SPxException& E)
-         {
-            MSG_ERROR(spxout << "Caught exception <" << E.what() << "> while computing compatability.\n");
-         }
-
-
          // comparing the constraints based upon the row norm
          if(y.isSetup())
          {
             for(int j = 0; j < y.size(); j++)
             {
-               if(isZero(_solver.fVec()[i], feastol))
+               if(isZero(_solver.fVec()[k], feastol))
                   norm += spxAbs(y.value(j)) * spxAbs(y.value(j));
             }
          }
@@ -1442,15 +1436,25 @@ void SoPlexBase<R>::_updateDecompReducedProblemViol(bool allrows)
          {
             for(int j = 0; j < numCols(); j++)
             {
-               if(isZero(_solver.fVec()[i], feastol))
+               if(isZero(_solver.fVec()[k], feastol))
                   norm += spxAbs(y[j]) * spxAbs(y[j]);
             }
          }
 
+         rownorms[k] = soplex::spxSqrt(norm);
+      });
+   }
+
+   // identifying the rows not included in the reduced problem that are violated by the current solution.
+   for(int i = 0; i < nrowstoadd; i++)
+   {
+      rowNumber = _decompViolatedRows[i];
 
+      if(!allrows)
+      {
          // the best row is based upon the row norm
          // the best row is added if no violated row is found
-         norm = soplex::spxSqrt(norm);
+         R norm = rownorms[i];
 
          if(LT(norm, bestrownorm))
          {
@@ -1556,77 +1560,100 @@ void SoPlexBase<R>::_findViolatedRows(R compObjValue, Array<RowViolation>& viola
       compProbSlackVal = compProbPrimal[_compSolver.number(_compSlackColId)];
    }
 
-   // scanning all rows of the complementary problem for violations.
-   for(int i = 0; i < _nPrimalRows; i++)
+   // scanning all rows of the complementary problem for violations. The rows are scanned in blocks that are distributed
+   // over the threads; the violated rows of each block are collected separately and appended in block order, such
+   // that the result does not depend on the number of threads.
+   bool usecompdual = boolParam(SoPlexBase<R>::USECOMPDUAL);
+   int nblocks = spxNumBlocks(_nPrimalRows);
+   std::vector<std::vector<RowViolation>> blockviolations(nblocks);
+
+   spxParallelFor(intParam(SoPlexBase<R>::THREADS), nblocks, [&](int b)
    {
-      LPRowBase<R> origlprow;
-      DSVectorBase<R> rowtoaddVec(_realLP->nCols());
-      R compProbViol = 0;
-      R compSlackCoeff = 0;
-      int rownumber = _realLP->number(SPxRowId(_decompPrimalRowIDs[i]));
-      int comprownum = _compSolver.number(SPxRowId(_decompPrimalRowIDs[i]));
+      int first;
+      int last;
+      spxBlockRange(b, _nPrimalRows, first, last);
+
+      // the second column of a ranged row is handled together with the first one in the previous block
+      if(usecompdual && first > 0 && _realLP->number(SPxRowId(_decompPrimalRowIDs[first - 1]))
+            == _realLP->number(SPxRowId(_decompPrimalRowIDs[first])))
+         first++;
 
-      if(!_decompReducedProbRows[rownumber])
+      for(int i = first; i < last; i++)
       {
-         // retreiving the violation of the complementary problem primal constraints
-         if(boolParam(SoPlexBase<R>::USECOMPDUAL))
-         {
-            compSlackCoeff = getCompSlackVarCoeff(i);
-            compProbViol = compProbRedcost[_compSolver.number(SPxColId(
-                                              _decompDualColIDs[i]))]; // this is b - Ax
-            // subtracting the slack variable value
-            compProbViol += compObjValue * compSlackCoeff; // must add on the slack variable value.
-            compProbViol *= compSlackCoeff;  // translating the violation to a <= constraint
-         }
-         else
+         R compProbViol = 0;
+         R compSlackCoeff = 0;
+         int rownumber = _realLP->number(SPxRowId(_decompPrimalRowIDs[i]));
+         int comprownum = _compSolver.number(SPxRowId(_decompPrimalRowIDs[i]));
+
+         if(!_decompReducedProbRows[rownumber])
          {
-            R viol = _compSolver.rhs(comprownum) - (compProbActivity[comprownum] + compProbSlackVal);
+            // retreiving the violation of the complementary problem primal constraints
+            if(usecompdual)
+            {
+               compSlackCoeff = getCompSlackVarCoeff(i);
+               compProbViol = compProbRedcost[_compSolver.number(SPxColId(
+                                                 _decompDualColIDs[i]))]; // this is b - Ax
+               // subtracting the slack variable value
+               compProbViol += compObjValue * compSlackCoeff; // must add on the slack variable value.
+               compProbViol *= compSlackCoeff;  // translating the violation to a <= constraint
+            }
+            else
+            {
+               R viol = _compSolver.rhs(comprownum) - (compProbActivity[comprownum] + compProbSlackVal);
 
-            if(viol < 0.0)
-               compProbViol = viol;
+               if(viol < 0.0)
+                  compProbViol = viol;
 
-            viol = (compProbActivity[comprownum] - compProbSlackVal) - _compSolver.lhs(comprownum);
+               viol = (compProbActivity[comprownum] - compProbSlackVal) - _compSolver.lhs(comprownum);
 
-            if(viol < 0.0)
-               compProbViol = viol;
+               if(viol < 0.0)
+                  compProbViol = viol;
 
-         }
+            }
 
-         // NOTE: if the row was originally a ranged constraint, we are only interest in one of the inequalities.
-         // If one inequality of the range violates the bounds, then we will add the row.
+            // NOTE: if the row was originally a ranged constraint, we are only interest in one of the inequalities.
+            // If one inequality of the range violates the bounds, then we will add the row.
 
-         // the translation of the complementary primal problem to the dual some rows resulted in two columns.
-         if(boolParam(SoPlexBase<R>::USECOMPDUAL) && i < _nPrimalRows - 1 &&
-               _realLP->number(SPxRowId(_decompPrimalRowIDs[i])) == _realLP->number(SPxRowId(
-                        _decompPrimalRowIDs[i + 1])))
-         {
-            i++;
-            compSlackCoeff = getCompSlackVarCoeff(i);
-            R tempViol = compProbRedcost[_compSolver.number(SPxColId(_decompDualColIDs[i]))]; // this is b - Ax
-            tempViol += compObjValue * compSlackCoeff;
-            tempViol *= compSlackCoeff;
-
-            // if the other side of the range constraint has a larger violation, then this is used for the
-            // computation.
-            if(tempViol < compProbViol)
-               compProbViol = tempViol;
-         }
+            // the translation of the complementary primal problem to the dual some rows resulted in two columns.
+            if(usecompdual && i < _nPrimalRows - 1 &&
+                  _realLP->number(SPxRowId(_decompPrimalRowIDs[i])) == _realLP->number(SPxRowId(
+                           _decompPrimalRowIDs[i + 1])))
+            {
+               i++;
+               compSlackCoeff = getCompSlackVarCoeff(i);
+               R tempViol = compProbRedcost[_compSolver.number(SPxColId(_decompDualColIDs[i]))]; // this is b - Ax
+               tempViol += compObjValue * compSlackCoeff;
+               tempViol *= compSlackCoeff;
+
+               // if the other side of the range constraint has a larger violation, then this is used for the
+               // computation.
+               if(tempViol < compProbViol)
+                  compProbViol = tempViol;
+            }
 
 
-         // checking the violation of the row.
-         if(LT(compProbViol, (R) 0, feastol))
-         {
-            if(!_decompReducedProbRows[rownumber])
+            // checking the violation of the row.
+            if(LT(compProbViol, (R) 0, feastol))
             {
-               numIncludedRows++;
-               assert(numIncludedRows <= _realLP->nRows());
+               RowViolation rowviol;
+               rowviol.idx = rownumber;
+               rowviol.violation = spxAbs(compProbViol);
+               blockviolations[b].push_back(rowviol);
             }
-
-            violatedrows[nviolatedrows].idx = rownumber;
-            violatedrows[nviolatedrows].violation = spxAbs(compProbViol);
-            nviolatedrows++;
          }
       }
+   });
+
+   for(int b = 0; b < nblocks; b++)
+   {
+      for(const RowViolation& rowviol : blockviolations[b])
+      {
+         numIncludedRows++;
+         assert(numIncludedRows <= _realLP->nRows());
+
+         violatedrows[nviolatedrows] = rowviol;
+         nviolatedrows++;
+      }
    }
 }
 
@@ -1713,6 +1740,66 @@ void SoPlexBase<R>::_getZeroDualMultiplierIndices(VectorBase<R> feasVector, int*
 
 
 
+/// solves y B = A_{i,.} with the basis of the reduced problem for the rows rows[0], ..., rows[nrows - 1]
+// The factorization of the basis can not be used by several threads at the same time. Hence, the rows are split into
+// one consecutive range per thread and every range except the first works on its own copy of the factorization. The
+// solution for row rows[k] is passed to func(k, y), where calls for different k may be executed concurrently.
+template <class R>
+template <class F>
+void SoPlexBase<R>::_solveDecompRows(const int* rows, int nrows, const F& func)
+{
+   if(nrows <= 0)
+      return;
+
+   int nranges = MINIMUM(intParam(SoPlexBase<R>::THREADS), (nrows - 1) / SOLVEROWS_PERTHREAD + 1);
+   std::vector<std::unique_ptr<SLinSolver<R>>> factors(nranges);
+   std::vector<int> nfailed(nranges, 0);
+
+   auto solveRange = [&](int range, int first, int last)
+   {
+      SSVectorBase<R> y(_solver.nCols());
+      y.unSetup();
+
+      for(int k = first; k < last; ++k)
+      {
+         try
+         {
+            if(factors[range])
+               factors[range]->solveRight(y, _solver.vector(rows[k]));
+            else
+               _solver.basis().solve(y, _solver.vector(rows[k]));
+         }
+         catch(const SPxException&)
+         {
+            nfailed[range]++;
+         }
+
+         func(k, y);
+      }
+   };
+
+   // the first solve uses the basis of the solver, which ensures that the factorization is up to date before it is
+   // copied for the other threads
+   solveRange(0, 0, 1);
+
+   for(int t = 1; t < nranges; ++t)
+      factors[t].reset(_slufactor.clone());
+
+   spxParallelFor(nranges, nranges, [&](int t)
+   {
+      solveRange(t, 1 + (int)((long long)(nrows - 1) * t / nranges),
+                 1 + (int)((long long)(nrows - 1) * (t + 1) / nranges));
+   });
+
+   for(int t = 0; t < nranges; ++t)
+   {
+      if(nfailed[t] > 0)
+         MSG_ERROR(spxout << "Caught exception in " << nfailed[t] << " solves while computing compatability.\n");
+   }
+}
+
+
+
 /// retrieves the compatible columns from the constraint matrix
 // This function also updates the constraint matrix of the reduced problem. It is efficient to perform this in the
 // following function because the required linear algebra has been performed.
@@ -1731,10 +1818,6 @@ void SoPlexBase<R>::_getCompatibleColumns(VectorBase<R> feasVector, int* nonposi
 #endif
 #endif
 
-   bool compatible;
-   SSVectorBase<R>  y(_solver.nCols());
-   y.unSetup();
-
    *ncompatind  = 0;
 
 #ifndef NDEBUG
@@ -1769,14 +1852,23 @@ void SoPlexBase<R>::_getCompatibleColumns(VectorBase<R> feasVector, int* nonposi
       _decompReducedProbColRowIDs.reSize(_solver.nRows());
    }
 
-   for(int i = 0; i < numRows(); ++i)
+   // the rows are processed in chunks: the solves for the rows of a chunk are distributed over the threads, afterwards
+   // the rows are classified and the reduced problem is updated sequentially in the order of the rows
+   int chunksize = 16 * SOLVEROWS_PERTHREAD * intParam(SoPlexBase<R>::THREADS);
+   std::vector<int> chunkrows;
+   std::vector<DSVectorBase<R>> newRowVectors;
+   std::vector<char> compatiblerows;
+
+   for(int first = 0; first < numRows() && !stop; first += chunksize)
    {
-      rowsforremoval[i] = i;
+      int last = MINIMUM(first + chunksize, numRows());
 
-      if(formRedProb)
-         _decompReducedProbRows[i] = true;
+      chunkrows.resize(last - first);
+      newRowVectors.resize(last - first);
+      compatiblerows.resize(last - first);
 
-      numIncludedRows++;
+      for(int i = first; i < last; ++i)
+         chunkrows[i - first] = i;
 
       // the rhs of this calculation are the rows of the constraint matrix
       // so we are solving y B = A_{i,.}
@@ -1784,93 +1876,103 @@ void SoPlexBase<R>::_getCompatibleColumns(VectorBase<R> feasVector, int* nonposi
       // approach breaks down. It could be simplier if we use a faster solve. Maybe something like:
       // Omer, J.; Towhidi, M. & Soumis, F., "The positive edge pricing rule for the dual simplex",
       // Computers & Operations Research , 2015, 61, 135-142
-      try
+      _solveDecompRows(chunkrows.data(), last - first, [&](int k, const SSVectorBase<R>& y)
       {
-         _solver.basis().solve(y, _solver.vector(i));
-      }
-      catch(const SPxException& E)
-      {
-         MSG_ERROR(spxout << "Caught exception <" << E.what() << "> while computing compatability.\n");
-      }
-
-      compatible = true;
+         bool compatible = true;
 
-      // a compatible row is given by zeros in all columns related to the nonpositive indices
-      for(int j = 0; j < nnonposind; ++j)
-      {
-         // @TODO: getting a tolerance issue with this check. Don't know how to fix it.
-         if(!isZero(y[nonposind[j]], feastol))
+         // a compatible row is given by zeros in all columns related to the nonpositive indices
+         for(int j = 0; j < nnonposind; ++j)
          {
-            compatible = false;
-            break;
+            // @TODO: getting a tolerance issue with this check. Don't know how to fix it.
+            if(!isZero(y[nonposind[j]], feastol))
+            {
+               compatible = false;
+               break;
+            }
          }
-      }
 
-      // checking that the active rows are compatible
-      assert(!activerows[i] || compatible);
+         compatiblerows[k] = compatible;
 
-      // changing the matrix coefficients
-      DSVectorBase<R> newRowVector;
-      LPRowBase<R> rowtoupdate;
+         // changing the matrix coefficients
+         DSVectorBase<R>& newRowVector = newRowVectors[k];
+         newRowVector.clear();
 
-      if(y.isSetup())
-      {
-         for(int j = 0; j < y.size(); j++)
-            // coverity[var_deref_model]
-            newRowVector.add(y.index(j), y.value(j));
-      }
-      else
-      {
-         for(int j = 0; j < numCols(); j++)
+         if(y.isSetup())
          {
-            if(!isZero(y[j], feastol))
-               newRowVector.add(j, y[j]);
+            for(int j = 0; j < y.size(); j++)
+               // coverity[var_deref_model]
+               newRowVector.add(y.index(j), y.value(j));
          }
-      }
+         else
+         {
+            for(int j = 0; j < numCols(); j++)
+            {
+               if(!isZero(y[j], feastol))
+                  newRowVector.add(j, y[j]);
+            }
+         }
+      });
 
-      // transforming the original problem rows
-      _solver.getRow(i, rowtoupdate);
+      for(int i = first; i < last; ++i)
+      {
+         rowsforremoval[i] = i;
 
-#ifndef NO_TRANSFORM
-      rowtoupdate.setRowVector(newRowVector);
-#endif
+         if(formRedProb)
+            _decompReducedProbRows[i] = true;
 
-      if(formRedProb)
-         _transformedRows.add(rowtoupdate);
+         numIncludedRows++;
 
+         bool compatible = compatiblerows[i - first];
 
-      // Making all equality constraints compatible, i.e. they are included in the reduced problem
-      if(EQ(rowtoupdate.lhs(), rowtoupdate.rhs()))
-         compatible = true;
+         // checking that the active rows are compatible
+         assert(!activerows[i] || compatible);
 
-      if(compatible)
-      {
-         compatind[*ncompatind] = i;
-         (*ncompatind)++;
+         LPRowBase<R> rowtoupdate;
+
+         // transforming the original problem rows
+         _solver.getRow(i, rowtoupdate);
+
+#ifndef NO_TRANSFORM
+         rowtoupdate.setRowVector(newRowVectors[i - first]);
+#endif
 
          if(formRedProb)
+            _transformedRows.add(rowtoupdate);
+
+
+         // Making all equality constraints compatible, i.e. they are included in the reduced problem
+         if(EQ(rowtoupdate.lhs(), rowtoupdate.rhs()))
+            compatible = true;
+
+         if(compatible)
          {
-            _decompReducedProbRowIDs[i] = _solver.rowId(i);
+            compatind[*ncompatind] = i;
+            (*ncompatind)++;
+
+            if(formRedProb)
+            {
+               _decompReducedProbRowIDs[i] = _solver.rowId(i);
 
-            // updating the compatible row
-            _decompLP->changeRow(i, rowtoupdate);
+               // updating the compatible row
+               _decompLP->changeRow(i, rowtoupdate);
+            }
          }
-      }
-      else
-      {
-         // setting an array to identify the rows to be removed from the LP to form the reduced problem
-         rowsforremoval[i] = -1;
-         numIncludedRows--;
+         else
+         {
+            // setting an array to identify the rows to be removed from the LP to form the reduced problem
+            rowsforremoval[i] = -1;
+            numIncludedRows--;
 
-         if(formRedProb)
-            _decompReducedProbRows[i] = false;
-      }
+            if(formRedProb)
+               _decompReducedProbRows[i] = false;
+         }
 
-      // determine whether the reduced problem setup should be terminated
-      stop = decompTerminate(realParam(SoPlexBase<R>::TIMELIMIT) * TIMELIMIT_FRAC);
+         // determine whether the reduced problem setup should be terminated
+         stop = decompTerminate(realParam(SoPlexBase<R>::TIMELIMIT) * TIMELIMIT_FRAC);
 
-      if(stop)
-         break;
+         if(stop)
+            break;
+      }
    }
 
    assert(numIncludedRows <= _solver.nRows());
@@ -2107,15 +2209,21 @@ void SoPlexBase<R>::_deleteAndUpdateRowsComplementaryProblem(SPxRowId rangedRowI
 {
    DSVectorBase<R> slackColCoeff;
 
-   // setting the objective coefficients of the original variables to zero
+   // freeing the original variables and setting their objective coefficients to zero; all changes are passed to the
+   // solver at once, such that the basis and the solver vectors are updated only once
    VectorBase<R> newObjCoeff(numCols());
+   VectorBase<R> newLower(_compSolver.lower());
+   VectorBase<R> newUpper(_compSolver.upper());
 
    for(int i = 0; i < numCols(); i++)
    {
-      _compSolver.changeBounds(_realLP->cId(i), R(-infinity), R(infinity));
+      int colnum = _compSolver.number(_realLP->cId(i));
+      newLower[colnum] = R(-infinity);
+      newUpper[colnum] = R(infinity);
       newObjCoeff[i] = 0;
    }
 
+   _compSolver.changeBounds(newLower, newUpper);
    _compSolver.changeObj(newObjCoeff);
 
    // adding the slack column to the complementary problem
@@ -2133,6 +2241,7 @@ void SoPlexBase<R>::_deleteAndUpdateRowsComplementaryProblem(SPxRowId rangedRowI
    {
       LPRowSetBase<R>
       addrangedrows;    // the row set of ranged and equality rows that must be added to the complementary problem.
+      VectorBase<R> newLhs(_compSolver.lhs());
       naddedrows = 0;
 
       // finding all of the ranged and equality rows and creating two <= constraints.
@@ -2144,12 +2253,15 @@ void SoPlexBase<R>::_deleteAndUpdateRowsComplementaryProblem(SPxRowId rangedRowI
             assert(_compSolver.rowType(i) == LPRowBase<R>::RANGE
                    || _compSolver.rowType(i) == LPRowBase<R>::EQUAL);
 
-            _compSolver.changeLhs(i, R(-infinity));
+            newLhs[i] = R(-infinity);
             addrangedrows.add(_realLP->lhs(i), _realLP->rowVector(i), R(infinity));
             naddedrows++;
          }
       }
 
+      if(naddedrows > 0)
+         _compSolver.changeLhs(newLhs);
+
       // adding the rows for the ranged rows to make <= conatraints
       SPxRowId* addedrowid = 0;
       spx_alloc(addedrowid, naddedrows);
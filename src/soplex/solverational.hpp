@@ -403,49 +403,60 @@ void SoPlexBase<R>::_storeRealSolutionAsRational(
    sol._isPrimalFeasible = true;
    sol._isDualFeasible = true;
 
-   for(int c = numColsRational() - 1; c >= 0; c--)
-   {
-      typename SPxSolverBase<R>::VarStatus& basisStatusCol = _basisStatusCols[c];
+   // every entry is converted into its own rational, hence the columns and rows can be processed by blocks in
+   // parallel
+   const int threads = intParam(SoPlexBase<R>::THREADS);
 
-      if(basisStatusCol == SPxSolverBase<R>::ON_LOWER)
-         sol._primal[c] = lowerRational(c);
-      else if(basisStatusCol == SPxSolverBase<R>::ON_UPPER)
-         sol._primal[c] = upperRational(c);
-      else if(basisStatusCol == SPxSolverBase<R>::FIXED)
+   spxParallelForRange(threads, numColsRational(), [&](int first, int last)
+   {
+      for(int c = first; c < last; c++)
       {
-         // it may happen that lower and upper are only equal in the Real LP but different in the rational LP; we do
-         // not check this to avoid rational comparisons, but simply switch the basis status to the lower bound; this
-         // is necessary, because for fixed variables any reduced cost is feasible
-         sol._primal[c] = lowerRational(c);
-         basisStatusCol = SPxSolverBase<R>::ON_LOWER;
+         typename SPxSolverBase<R>::VarStatus& basisStatusCol = _basisStatusCols[c];
+
+         if(basisStatusCol == SPxSolverBase<R>::ON_LOWER)
+            sol._primal[c] = lowerRational(c);
+         else if(basisStatusCol == SPxSolverBase<R>::ON_UPPER)
+            sol._primal[c] = upperRational(c);
+         else if(basisStatusCol == SPxSolverBase<R>::FIXED)
+         {
+            // it may happen that lower and upper are only equal in the Real LP but different in the rational LP; we
+            // do not check this to avoid rational comparisons, but simply switch the basis status to the lower bound;
+            // this is necessary, because for fixed variables any reduced cost is feasible
+            sol._primal[c] = lowerRational(c);
+            basisStatusCol = SPxSolverBase<R>::ON_LOWER;
+         }
+         else if(basisStatusCol == SPxSolverBase<R>::ZERO)
+            sol._primal[c] = 0;
+         else
+            sol._primal[c].assign(primalReal[c]);
       }
-      else if(basisStatusCol == SPxSolverBase<R>::ZERO)
-         sol._primal[c] = 0;
-      else
-         sol._primal[c].assign(primalReal[c]);
-   }
+   });
 
    _rationalLP->computePrimalActivity(sol._primal, sol._slacks);
 
    assert(dualSize == 0);
 
-   for(int r = numRowsRational() - 1; r >= 0; r--)
+   spxParallelForRange(threads, numRowsRational(), [&](int first, int last)
    {
-      typename SPxSolverBase<R>::VarStatus& basisStatusRow = _basisStatusRows[r];
+      for(int r = first; r < last; r++)
+      {
+         typename SPxSolverBase<R>::VarStatus& basisStatusRow = _basisStatusRows[r];
 
-      // it may happen that left-hand and right-hand side are different in the rational, but equal in the Real LP,
-      // leading to a fixed basis status; this is critical because rows with fixed basis status are ignored in the
-      // computation of the dual violation; to avoid rational comparisons we do not check this but simply switch to
-      // the left-hand side status
-      if(basisStatusRow == SPxSolverBase<R>::FIXED)
-         basisStatusRow = SPxSolverBase<R>::ON_LOWER;
+         // it may happen that left-hand and right-hand side are different in the rational, but equal in the Real LP,
+         // leading to a fixed basis status; this is critical because rows with fixed basis status are ignored in the
+         // computation of the dual violation; to avoid rational comparisons we do not check this but simply switch
+         // to the left-hand side status
+         if(basisStatusRow == SPxSolverBase<R>::FIXED)
+            basisStatusRow = SPxSolverBase<R>::ON_LOWER;
 
-      {
          sol._dual[r].assign(dualReal[r]);
-
-         if(dualReal[r] != 0.0)
-            dualSize++;
       }
+   });
+
+   for(int r = numRowsRational() - 1; r >= 0; r--)
+   {
+      if(dualReal[r] != 0.0)
+         dualSize++;
    }
 
    // we assume that the objective function vector has less nonzeros than the reduced cost vector, and so multiplying
@@ -2220,12 +2231,18 @@ void SoPlexBase<R>::_storeLPReal()
 {
 #ifndef SOPLEX_MANUAL_ALT
 
-   if(intParam(SoPlexBase<R>::SYNCMODE) == SYNCMODE_MANUAL)
+   // in manual sync mode, the real LP may differ from the rational LP; lifting changes the matrix coefficients of the
+   // original rows, which _project() does not restore, hence we need a full copy of the real LP; all other
+   // transformations only add and remove rows and columns at the end and change objective, bounds, and sides
+   if(intParam(SoPlexBase<R>::SYNCMODE) == SYNCMODE_MANUAL && boolParam(SoPlexBase<R>::LIFTING))
    {
       _manualRealLP = *_realLP;
       return;
    }
 
+   if(intParam(SoPlexBase<R>::SYNCMODE) == SYNCMODE_MANUAL)
+      _statistics->lpCopyMemorySaved += _realLP->nzoMemory();
+
 #endif
 
    _manualLower = _realLP->lower();
@@ -2245,14 +2262,21 @@ void SoPlexBase<R>::_restoreLPReal()
    if(intParam(SoPlexBase<R>::SYNCMODE) == SYNCMODE_MANUAL)
    {
 #ifndef SOPLEX_MANUAL_ALT
-      _solver.loadLP(_manualRealLP);
-#else
-      _realLP->changeLower(_manualLower);
-      _realLP->changeUpper(_manualUpper);
-      _realLP->changeLhs(_manualLhs);
-      _realLP->changeRhs(_manualRhs);
-      _realLP->changeObj(_manualObj);
+
+      if(boolParam(SoPlexBase<R>::LIFTING))
+      {
+         _solver.loadLP(_manualRealLP);
+         _manualRealLP.clear();
+      }
+      else
 #endif
+      {
+         _realLP->changeLower(_manualLower);
+         _realLP->changeUpper(_manualUpper);
+         _realLP->changeLhs(_manualLhs);
+         _realLP->changeRhs(_manualRhs);
+         _realLP->changeObj(_manualObj);
+      }
 
       if(_hasBasis)
       {
@@ -3563,13 +3587,16 @@ typename SPxSolverBase<R>::Status SoPlexBase<R>::_solveRealForRational(bool from
    // start timing
    _statistics->syncTime->start();
 
-   // if preprocessing is applied, we need to restore the original LP at the end
-   SPxLPRational* rationalLP = 0;
+   // if preprocessing is applied, we need to restore the original LP at the end; since the LP holds floating-point
+   // values, a floating-point copy restores it exactly
+   SPxLPBase<R>* realLP = 0;
 
    if(_simplifier != 0 || _scaler != nullptr)
    {
-      spx_alloc(rationalLP);
-      rationalLP = new(rationalLP) SPxLPRational(_solver);
+      spx_alloc(realLP);
+      realLP = new(realLP) SPxLPBase<R>(_solver);
+      _statistics->lpCopyMemorySaved += size_t(realLP->nzoMemory() / sizeof(Nonzero<R>))
+                                        * (sizeof(Nonzero<Rational>) - sizeof(Nonzero<R>));
    }
 
    // with preprocessing or solving from scratch, the basis may change, hence invalidate the
@@ -3790,10 +3817,10 @@ typename SPxSolverBase<R>::Status SoPlexBase<R>::_solveRealForRational(bool from
    // restore original LP if necessary
    if(_simplifier != 0 || _scaler != nullptr)
    {
-      assert(rationalLP != 0);
-      _solver.loadLP((SPxLPBase<R>)(*rationalLP));
-      rationalLP->~SPxLPRational();
-      spx_free(rationalLP);
+      assert(realLP != 0);
+      _solver.loadLP(*realLP);
+      realLP->~SPxLPBase<R>();
+      spx_free(realLP);
 
       if(_hasBasis)
          _solver.setBasis(basisStatusRows.get_ptr(), basisStatusCols.get_ptr());
@@ -22,11 +22,14 @@
 /*                                                                           */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #include <assert.h>
 
 #include "soplex.h"
 #include "soplex/statistics.h"
+#include "soplex/spxthreads.h"
 
 #define ALLOWED_UNSCALE_PERCENTAGE    0.1
 #define MIN_OPT_CALLS_WITH_SCALING     10
@@ -46,17 +49,26 @@ void SoPlexBase<R>::_optimize(volatile bool* interrupt)
    // start timing
    _statistics->solvingTime->start();
 
+   // generated columns are only kept warm if there is still a basis
+   if(!_hasBasis)
+      _colGenWarmStart = false;
+
    if(boolParam(SoPlexBase<R>::PERSISTENTSCALING))
    {
-      // scale original problem; overwriting _realLP
-      if(_scaler && !_realLP->isScaled() && _reapplyPersistentScaling())
+      // scale original problem; overwriting _realLP; after generating columns, the LP is not rescaled
+      if(_scaler && !_realLP->isScaled() && !_colGenWarmStart && _reapplyPersistentScaling())
       {
 #ifdef SOPLEX_DEBUG
          SPxLPBase<R>* origLP = 0;
          spx_alloc(origLP);
          origLP = new(origLP) SPxLPBase<R>(*_realLP);
 #endif
-         _scaler->scale(*_realLP, true);
+         // restore the scaling of a warm-start file, to which its dual norms refer
+         if(int(_warmStartRowScaleExp.size()) == numRows() && int(_warmStartColScaleExp.size()) == this->numCols())
+            _scaler->restoreScaling(*_realLP, _warmStartRowScaleExp, _warmStartColScaleExp);
+         else
+            _scaler->scale(*_realLP, true);
+
          _isRealLPScaled = _realLP->isScaled(); // a scaler might decide not to apply scaling
          _solver.invalidateBasis();
 #ifdef SOPLEX_DEBUG
@@ -72,12 +84,18 @@ void SoPlexBase<R>::_optimize(volatile bool* interrupt)
       }
    }
 
+   // the scaling of a warm-start file only applies to the solve directly following it
+   _warmStartRowScaleExp.clear();
+   _warmStartColScaleExp.clear();
+
    // remember that last solve was in floating-point
    _lastSolveMode = SOLVEMODE_REAL;
 
    // solve and store solution; if we have a starting basis, do not apply preprocessing; if we are solving from
-   // scratch, apply preprocessing according to parameter settings
-   if(!_hasBasis && realParam(SoPlexBase<R>::OBJLIMIT_LOWER) == -realParam(SoPlexBase<R>::INFTY)
+   // scratch, apply preprocessing according to parameter settings; lazy row generation never applies preprocessing
+   if(boolParam(SoPlexBase<R>::LAZYROWS))
+      _solveRealLazyRows(interrupt);
+   else if(!_hasBasis && realParam(SoPlexBase<R>::OBJLIMIT_LOWER) == -realParam(SoPlexBase<R>::INFTY)
          && realParam(SoPlexBase<R>::OBJLIMIT_UPPER) == realParam(SoPlexBase<R>::INFTY))
       _preprocessAndSolveReal(true, interrupt);
    else
@@ -317,9 +335,11 @@ void SoPlexBase<R>::_preprocessAndSolveReal(bool applySimplifier, volatile bool*
          keepbounds &= boolParam(SoPlexBase<R>::ROWBOUNDFLIPS);
 
       Real remainingTime = _solver.getMaxTime() - _solver.time();
+      _statistics->preprocessingMemory = _solver.nzoMemory();
       simplificationStatus = _simplifier->simplify(_solver, realParam(SoPlexBase<R>::EPSILON_ZERO),
                              realParam(SoPlexBase<R>::FEASTOL), realParam(SoPlexBase<R>::OPTTOL), remainingTime, keepbounds,
                              _solver.random.getSeed());
+      _statistics->preprocessingPeakMemory = _simplifier->peakMemory();
       _solver.changeObjOffset(_simplifier->getObjoffset() + realParam(SoPlexBase<R>::OBJ_OFFSET));
       _solver.setScalingInfo(false);
       _applyPolishing = true;
@@ -346,6 +366,276 @@ void SoPlexBase<R>::_preprocessAndSolveReal(bool applySimplifier, volatile bool*
 
 
 
+/// solves real LP on a set of active rows, adding violated rows lazily, and finally resolves the full LP
+// The solver starts with the equality rows and, if a basis is available, the rows that are nonbasic in this basis.
+// After each solve, the inactive rows are checked for violations in parallel; the most violated rows are appended to
+// the solver in one batch, which keeps the current basis, and rows whose slack stayed basic for LAZYROWS_AGE
+// consecutive rounds are removed again.  Every row is removed at most once, hence the loop terminates.  Finally, the
+// full LP is loaded with the basis of the active rows and basic slacks for all other rows and solved again, which
+// needs no pivots if no row is violated and sets up the solution data in the usual way.
+template <class R>
+void SoPlexBase<R>::_solveRealLazyRows(volatile bool* interrupt)
+{
+   assert(_isRealLPLoaded);
+   assert(_realLP == &_solver);
+
+   // rows are copied from the real LP into the solver, hence both have to be unscaled
+   if(_realLP->isScaled())
+   {
+      _solver.unscaleLPandReloadBasis();
+      _isRealLPScaled = false;
+      ++_unscaleCalls;
+   }
+
+   _disableSimplifierAndScaler();
+
+   const int nrows = _solver.nRows();
+   const bool hadBasis = _hasBasis && _solver.basis().status() > SPxBasisBase<R>::NO_PROBLEM;
+
+   // position of each row of the real LP in the solver, or -1 if the row is inactive
+   DataArray<int> activeRows(nrows);
+   DataArray<int> slackAge(nrows);
+   DataArray<bool> wasDropped(nrows);
+   int nactive = 0;
+
+   for(int i = 0; i < nrows; i++)
+   {
+      bool active = _solver.rowType(i) == LPRowBase<R>::EQUAL
+                    || (hadBasis && _solver.getBasisRowStatus(i) != SPxSolverBase<R>::BASIC);
+
+      activeRows[i] = active ? nactive++ : -1;
+      slackAge[i] = 0;
+      wasDropped[i] = false;
+   }
+
+   if(nactive == nrows)
+   {
+      _preprocessAndSolveReal(false, interrupt);
+      return;
+   }
+
+   // keep the full LP as real LP and reduce the LP in the solver to the active rows
+   _realLP = nullptr;
+   spx_alloc(_realLP);
+   _realLP = new(_realLP) SPxLPBase<R>(_solver);
+   _isRealLPLoaded = false;
+
+   DataArray<int> perm(nrows);
+   DataArray<int> origRows(nactive);
+
+   for(int i = 0; i < nrows; i++)
+      perm[i] = activeRows[i];
+
+   _solver.removeRows(perm.get_ptr());
+   assert(_solver.nRows() == nactive);
+
+   for(int i = 0; i < nrows; i++)
+   {
+      activeRows[i] = perm[i];
+
+      if(perm[i] >= 0)
+         origRows[perm[i]] = i;
+   }
+
+   MSG_INFO1(spxout, spxout << "Lazy row generation: starting with " << nactive << " of " << nrows
+             << " rows\n");
+
+   const int batch = intParam(SoPlexBase<R>::LAZYROWS_BATCH);
+   const int maxAge = intParam(SoPlexBase<R>::LAZYROWS_AGE);
+   std::vector<RowViolation> violations;
+   VectorBase<R> x(_solver.nCols());
+   int round = 0;
+
+   while(true)
+   {
+      _solveRealLPAndRecordStatistics(interrupt);
+      round++;
+
+      typename SPxSolverBase<R>::Status solverStat = _solver.status();
+
+      // an unbounded ray of the active rows may be blocked by inactive rows; infeasibility of the active rows proves
+      // infeasibility of the full LP and all other states are handled by the final solve
+      if(solverStat == SPxSolverBase<R>::OPTIMAL)
+      {
+         _solver.getPrimalSol(x);
+         _findLazyRowViolations(x, false, activeRows, violations);
+      }
+      else if(solverStat == SPxSolverBase<R>::UNBOUNDED)
+      {
+         _solver.getPrimalray(x);
+         _findLazyRowViolations(x, true, activeRows, violations);
+      }
+      else
+         break;
+
+      if(violations.empty())
+         break;
+
+      // remove rows whose slack has been basic for too many consecutive rounds; rows with basic slack can be removed
+      // without losing the regularity of the basis
+      int ndropped = 0;
+
+      if(solverStat == SPxSolverBase<R>::OPTIMAL && maxAge >= 0)
+      {
+         perm.reSize(_solver.nRows());
+
+         for(int k = 0; k < _solver.nRows(); k++)
+         {
+            int i = origRows[k];
+            perm[k] = k;
+
+            if(_realLP->rowType(i) == LPRowBase<R>::EQUAL || wasDropped[i])
+               continue;
+
+            if(_solver.getBasisRowStatus(k) != SPxSolverBase<R>::BASIC)
+               slackAge[i] = 0;
+            else if(++slackAge[i] > maxAge)
+            {
+               perm[k] = -1;
+               activeRows[i] = -1;
+               wasDropped[i] = true;
+               ndropped++;
+            }
+         }
+
+         if(ndropped > 0)
+         {
+            DataArray<int> prevOrigRows(origRows);
+
+            _solver.removeRows(perm.get_ptr());
+            origRows.reSize(_solver.nRows());
+
+            for(int k = 0; k < perm.size(); k++)
+            {
+               if(perm[k] >= 0)
+               {
+                  origRows[perm[k]] = prevOrigRows[k];
+                  activeRows[prevOrigRows[k]] = perm[k];
+               }
+            }
+         }
+      }
+
+      // add the most violated rows, the order of the violation values is broken by the row index
+      if((int)violations.size() > batch)
+      {
+         std::nth_element(violations.begin(), violations.begin() + batch, violations.end(),
+                          [](const RowViolation & a, const RowViolation & b)
+         {
+            return a.violation > b.violation || (a.violation == b.violation && a.idx < b.idx);
+         });
+         violations.resize(batch);
+      }
+
+      std::sort(violations.begin(), violations.end(), [](const RowViolation & a, const RowViolation & b)
+      {
+         return a.idx < b.idx;
+      });
+
+      LPRowSetBase<R> addedRows((int)violations.size());
+
+      for(const RowViolation& violation : violations)
+         addedRows.add(_realLP->lhs(violation.idx), _realLP->rowVector(violation.idx), _realLP->rhs(violation.idx));
+
+      int firstNew = _solver.nRows();
+      _solver.addRows(addedRows);
+      origRows.reSize(_solver.nRows());
+
+      for(int k = 0; k < (int)violations.size(); k++)
+      {
+         origRows[firstNew + k] = violations[k].idx;
+         activeRows[violations[k].idx] = firstNew + k;
+         slackAge[violations[k].idx] = 0;
+      }
+
+      MSG_INFO2(spxout, spxout << "Lazy row generation round " << round << ": added " << violations.size()
+                << " rows, removed " << ndropped << " rows, " << _solver.nRows() << " of " << nrows
+                << " rows active\n");
+   }
+
+   MSG_INFO1(spxout, spxout << "Lazy row generation: " << round << " rounds, " << _solver.nRows() << " of "
+             << nrows << " rows active\n");
+
+   // extend the basis of the active rows by basic slacks of the inactive rows and solve the full LP from it
+   if(_solver.basis().status() > SPxBasisBase<R>::NO_PROBLEM)
+   {
+      DataArray< typename SPxSolverBase<R>::VarStatus > activeRowStatus(_solver.nRows());
+
+      _basisStatusRows.reSize(nrows);
+      _basisStatusCols.reSize(_solver.nCols());
+      _solver.getBasis(activeRowStatus.get_ptr(), _basisStatusCols.get_ptr(), activeRowStatus.size(),
+                       _basisStatusCols.size());
+
+      for(int i = 0; i < nrows; i++)
+         _basisStatusRows[i] = activeRows[i] >= 0 ? activeRowStatus[activeRows[i]] : SPxSolverBase<R>::BASIC;
+
+      _hasBasis = true;
+   }
+   else
+      _hasBasis = false;
+
+   _preprocessAndSolveReal(false, interrupt);
+}
+
+
+
+/// collects the rows of the real LP not active in the solver that are violated by \p x or block the ray \p x
+// The rows are scanned in blocks distributed over the threads; the violations of each block are appended in block
+// order, such that the result does not depend on the number of threads.
+template <class R>
+void SoPlexBase<R>::_findLazyRowViolations(const VectorBase<R>& x, bool isRay,
+      const DataArray<int>& activeRows, std::vector<RowViolation>& violations)
+{
+   const R feastol = realParam(SoPlexBase<R>::FEASTOL);
+   const int nrows = _realLP->nRows();
+   const int nblocks = spxNumBlocks(nrows);
+   std::vector<std::vector<RowViolation>> blockViolations(nblocks);
+
+   spxParallelFor(intParam(SoPlexBase<R>::THREADS), nblocks, [&](int b)
+   {
+      int first;
+      int last;
+      spxBlockRange(b, nrows, first, last);
+
+      for(int i = first; i < last; i++)
+      {
+         if(activeRows[i] >= 0)
+            continue;
+
+         R activity = x * _realLP->rowVector(i);
+         R viol = 0;
+
+         if(isRay)
+         {
+            // a ray is blocked by every finite side it moves towards
+            if(activity > feastol && _realLP->rhs(i) < R(infinity))
+               viol = activity;
+            else if(activity < -feastol && _realLP->lhs(i) > R(-infinity))
+               viol = -activity;
+         }
+         else if(activity - _realLP->rhs(i) > feastol)
+            viol = activity - _realLP->rhs(i);
+         else if(_realLP->lhs(i) - activity > feastol)
+            viol = _realLP->lhs(i) - activity;
+
+         if(viol > 0)
+         {
+            RowViolation rowViol;
+            rowViol.violation = viol;
+            rowViol.idx = i;
+            blockViolations[b].push_back(rowViol);
+         }
+      }
+   });
+
+   violations.clear();
+
+   for(int b = 0; b < nblocks; b++)
+      violations.insert(violations.end(), blockViolations[b].begin(), blockViolations[b].end());
+}
+
+
+
 /// loads original problem into solver and solves again after it has been solved to infeasibility or unboundedness with preprocessing
 template <class R>
 void SoPlexBase<R>::_resolveWithoutPreprocessing(typename SPxSimplifier<R>::Result
@@ -0,0 +1,370 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <assert.h>
+
+#include "soplex/spxdefines.h"
+#include "soplex.h"
+#include "soplex/spxthreads.h"
+
+#define SCENARIO_CHAINLENGTH  8   /**< the number of scenarios solved in a row, each warm-started from its predecessor */
+
+/* This file contains the functions for solving several scenarios of the real LP
+ *
+ * A scenario replaces the sides and bounds of the real LP.  All scenarios are solved on copies of one shared, possibly
+ * scaled, LP, where each thread keeps one copy together with its own basis, factorization and solution vectors.  The
+ * scenarios are ordered in a chain in which every scenario is followed by its nearest unsolved scenario, starting from
+ * the real LP itself.  The chain is cut into pieces of SCENARIO_CHAINLENGTH scenarios that are distributed over the
+ * threads: the first scenario of a piece starts from the basis of the real LP, every other one from the basis of its
+ * predecessor.  Since the pieces do not depend on the number of threads and the solver state is reset at the start of
+ * each piece, the results do not depend on the number of threads either. */
+
+namespace soplex
+{
+
+/// solves the real LP for each scenario of sides and bounds in \p scenarios and stores the results in the scenarios
+template <class R>
+bool SoPlexBase<R>::optimizeScenariosReal(std::vector<Scenario>& scenarios, volatile bool* interrupt)
+{
+   assert(_realLP != 0);
+
+   const int nscenarios = int(scenarios.size());
+
+   for(int s = 0; s < nscenarios; s++)
+   {
+      const Scenario& scenario = scenarios[s];
+
+      if((scenario.lhs.dim() != 0 && scenario.lhs.dim() != numRows())
+            || (scenario.rhs.dim() != 0 && scenario.rhs.dim() != numRows())
+            || (scenario.lower.dim() != 0 && scenario.lower.dim() != numCols())
+            || (scenario.upper.dim() != 0 && scenario.upper.dim() != numCols()))
+      {
+         MSG_INFO1(spxout, spxout << "Scenario " << s << " does not match the dimension of the LP.\n");
+         return false;
+      }
+   }
+
+   if(nscenarios == 0)
+      return true;
+
+   Timer* timer = TimerFactory::createTimer((Timer::TYPE) intParam(SoPlexBase<R>::TIMER));
+   timer->start();
+
+   // unscaled sides and bounds of the real LP, used for the entries not given by a scenario
+   VectorBase<R> baseLhs(numRows());
+   VectorBase<R> baseRhs(numRows());
+   VectorBase<R> baseLower(numCols());
+   VectorBase<R> baseUpper(numCols());
+   _realLP->getLhsUnscaled(baseLhs);
+   _realLP->getRhsUnscaled(baseRhs);
+   _realLP->getLowerUnscaled(baseLower);
+   _realLP->getUpperUnscaled(baseUpper);
+
+   // the shared LP is the real LP if it is persistently scaled or scaling is turned off; otherwise it is scaled once
+   const SPxLPBase<R>* sharedLP = _realLP;
+   SPxScaler<R>* scaler = _realLP->isScaled() ? _scaler : 0;
+   std::unique_ptr<SPxLPBase<R>> scaledLP;
+   std::unique_ptr<SPxScaler<R>> scaledLPScaler;
+
+   if(!_realLP->isScaled() && intParam(SoPlexBase<R>::SCALER) != SCALER_OFF)
+   {
+      SPxSimplifier<R>* simplifier = _simplifier;
+      SPxScaler<R>* realScaler = _scaler;
+
+      _enableSimplifierAndScaler();
+      scaledLPScaler.reset(_scaler->clone());
+
+      _simplifier = simplifier;
+      _scaler = realScaler;
+
+      scaledLP.reset(new SPxLPBase<R>(*_realLP));
+      scaledLPScaler->scale(*scaledLP, true);
+
+      if(scaledLP->isScaled())
+      {
+         sharedLP = scaledLP.get();
+         scaler = scaledLPScaler.get();
+      }
+   }
+
+   assert(!sharedLP->isScaled() || scaler != 0);
+
+   // starting basis of every piece of the chain
+   const bool hasBasis = _hasBasis && (!_isRealLPLoaded
+                                       || _solver.basis().status() > SPxBasisBase<R>::NO_PROBLEM);
+   DataArray< typename SPxSolverBase<R>::VarStatus > baseRows(numRows());
+   DataArray< typename SPxSolverBase<R>::VarStatus > baseCols(numCols());
+
+   if(hasBasis && _isRealLPLoaded)
+      _solver.getBasis(baseRows.get_ptr(), baseCols.get_ptr(), baseRows.size(), baseCols.size());
+   else if(hasBasis)
+   {
+      baseRows = _basisStatusRows;
+      baseCols = _basisStatusCols;
+   }
+
+   // order the scenarios in a chain of nearest neighbours
+   std::vector<int> chain;
+   _chainScenarios(scenarios, baseLhs, baseRhs, baseLower, baseUpper, chain);
+
+   const int npieces = (nscenarios + SCENARIO_CHAINLENGTH - 1) / SCENARIO_CHAINLENGTH;
+   const int nworkers = std::max(1, std::min(intParam(SoPlexBase<R>::THREADS), npieces));
+
+   // the solver output is not shared between threads; only errors are reported
+   SPxOut workerOut(spxout);
+   workerOut.setVerbosity(SPxOut::ERROR);
+
+   const R feastol = std::max(realParam(SoPlexBase<R>::FEASTOL),
+                              _currentSettings->realParam.lower[SoPlexBase<R>::FPFEASTOL]);
+   const R opttol = std::max(realParam(SoPlexBase<R>::OPTTOL),
+                             _currentSettings->realParam.lower[SoPlexBase<R>::FPOPTTOL]);
+   const bool columnRep = intParam(SoPlexBase<R>::REPRESENTATION) == SoPlexBase<R>::REPRESENTATION_COLUMN
+                          || (intParam(SoPlexBase<R>::REPRESENTATION) == SoPlexBase<R>::REPRESENTATION_AUTO
+                              && (numCols() + 1) * realParam(SoPlexBase<R>::REPRESENTATION_SWITCH) >= (numRows() + 1));
+   std::vector<int> workerIterations(nworkers, 0);
+
+   spxParallelFor(nworkers, nworkers, [&](int w)
+   {
+      // every worker keeps its own copy of the shared LP, basis and factorization
+      SPxSolverBase<R> worker(_solver);
+      worker.setOutstream(workerOut);
+
+      if(sharedLP != &_solver)
+         worker.loadLP(*sharedLP, false);
+
+      worker.setFeastol(feastol);
+      worker.setOpttol(opttol);
+      worker.setTerminationValue(intParam(SoPlexBase<R>::OBJSENSE) == SoPlexBase<R>::OBJSENSE_MINIMIZE
+                                 ? realParam(SoPlexBase<R>::OBJLIMIT_UPPER) : realParam(SoPlexBase<R>::OBJLIMIT_LOWER));
+      worker.setTerminationIter(intParam(SoPlexBase<R>::ITERLIMIT));
+      worker.setTerminationTime(realParam(SoPlexBase<R>::TIMELIMIT) < realParam(SoPlexBase<R>::INFTY)
+                                ? Real(realParam(SoPlexBase<R>::TIMELIMIT)) : Real(realParam(SoPlexBase<R>::INFTY)));
+      worker.changeObjOffset(realParam(SoPlexBase<R>::OBJ_OFFSET));
+      worker.setRep(columnRep ? SPxSolverBase<R>::COLUMN : SPxSolverBase<R>::ROW);
+
+      // changed sides and bounds keep the basis dual feasible, hence the dual simplex is used
+      worker.setType(columnRep ? SPxSolverBase<R>::LEAVE : SPxSolverBase<R>::ENTER);
+
+      DataArray< typename SPxSolverBase<R>::VarStatus > startRows(numRows());
+      DataArray< typename SPxSolverBase<R>::VarStatus > startCols(numCols());
+
+      for(int piece = w; piece < npieces; piece += nworkers)
+      {
+         const int first = piece * SCENARIO_CHAINLENGTH;
+         const int last = std::min(nscenarios, first + SCENARIO_CHAINLENGTH);
+
+         for(int p = first; p < last; p++)
+         {
+            Scenario& scenario = scenarios[chain[p]];
+            const bool isWarm = (p > first && scenarios[chain[p - 1]].status == SPxSolverBase<R>::OPTIMAL);
+            const VectorBase<R>& lhs = scenario.lhs.dim() > 0 ? scenario.lhs : baseLhs;
+            const VectorBase<R>& rhs = scenario.rhs.dim() > 0 ? scenario.rhs : baseRhs;
+            const VectorBase<R>& lower = scenario.lower.dim() > 0 ? scenario.lower : baseLower;
+            const VectorBase<R>& upper = scenario.upper.dim() > 0 ? scenario.upper : baseUpper;
+
+            worker.changeRange(lhs, rhs, sharedLP->isScaled());
+            worker.changeBounds(lower, upper, sharedLP->isScaled());
+
+            // reset the solver state at the start of each piece and after a failed solve; the starting basis is
+            // adapted to the sides and bounds of the scenario
+            if(!isWarm)
+            {
+               for(int i = 0; i < numRows(); i++)
+                  startRows[i] = _scenarioVarStatus(hasBasis ? baseRows[i] : SPxSolverBase<R>::BASIC, lhs[i], rhs[i]);
+
+               for(int i = 0; i < numCols(); i++)
+                  startCols[i] = _scenarioVarStatus(hasBasis ? baseCols[i] : SPxSolverBase<R>::ZERO, lower[i], upper[i]);
+
+               worker.setBasis(startRows.get_const_ptr(), startCols.get_const_ptr());
+               worker.weightsAreSetup = false;
+               worker.random.setSeed(_solver.random.getSeed());
+            }
+
+            scenario.warmStart = isWarm ? chain[p - 1] : -1;
+
+            try
+            {
+               worker.solve(interrupt);
+               scenario.status = worker.status();
+            }
+            catch(const SPxException& E)
+            {
+               scenario.status = SPxSolverBase<R>::ERROR;
+            }
+
+            scenario.iterations = worker.iterations();
+            workerIterations[w] += scenario.iterations;
+
+            if(scenario.status == SPxSolverBase<R>::OPTIMAL)
+            {
+               worker.forceRecompNonbasicValue();
+               scenario.objValue = worker.objValue();
+
+               scenario.primal.reDim(numCols());
+               scenario.dual.reDim(numRows());
+               worker.getPrimalSol(scenario.primal);
+               worker.getDualSol(scenario.dual);
+
+               if(sharedLP->isScaled())
+               {
+                  scaler->unscalePrimal(*sharedLP, scenario.primal);
+                  scaler->unscaleDual(*sharedLP, scenario.dual);
+               }
+            }
+            else
+            {
+               scenario.objValue = (scenario.status == SPxSolverBase<R>::INFEASIBLE)
+                                   ? -realParam(SoPlexBase<R>::INFTY) * intParam(SoPlexBase<R>::OBJSENSE)
+                                   : realParam(SoPlexBase<R>::INFTY) * intParam(SoPlexBase<R>::OBJSENSE);
+               scenario.primal.reDim(0);
+               scenario.dual.reDim(0);
+            }
+         }
+      }
+   });
+
+   timer->stop();
+
+   int totalIterations = 0;
+
+   for(int w = 0; w < nworkers; w++)
+      totalIterations += workerIterations[w];
+
+   MSG_INFO1(spxout, spxout << "Solved " << nscenarios << " scenarios in " << npieces << " chains on " << nworkers
+             << " threads with " << totalIterations << " iterations in " << timer->time() << " seconds.\n");
+
+   timer->~Timer();
+   spx_free(timer);
+
+   return true;
+}
+
+
+
+/// returns the nonbasic status \p status adapted to the bounds \p lower and \p upper of a scenario
+template <class R>
+typename SPxSolverBase<R>::VarStatus SoPlexBase<R>::_scenarioVarStatus(typename SPxSolverBase<R>::VarStatus
+      status, R lower, R upper) const
+{
+   if(status == SPxSolverBase<R>::BASIC)
+      return status;
+
+   if(lower == upper)
+      return SPxSolverBase<R>::FIXED;
+
+   if(status == SPxSolverBase<R>::ON_UPPER && upper < R(infinity))
+      return status;
+
+   if(lower > R(-infinity))
+      return SPxSolverBase<R>::ON_LOWER;
+
+   if(upper < R(infinity))
+      return SPxSolverBase<R>::ON_UPPER;
+
+   return SPxSolverBase<R>::ZERO;
+}
+
+
+
+/// orders the scenarios in a chain starting from the real LP, where each scenario is followed by its nearest
+/// unchained scenario
+// The distance of two scenarios counts each entry that is finite in one scenario and infinite in the other as one and
+// adds the relative difference of the other entries; ties are broken by the smallest index.
+template <class R>
+void SoPlexBase<R>::_chainScenarios(const std::vector<Scenario>& scenarios, const VectorBase<R>& baseLhs,
+                                    const VectorBase<R>& baseRhs, const VectorBase<R>& baseLower,
+                                    const VectorBase<R>& baseUpper, std::vector<int>& chain)
+{
+   const int nscenarios = int(scenarios.size());
+   const R inf = realParam(SoPlexBase<R>::INFTY);
+
+   auto vectorDistance = [inf](const VectorBase<R>& a, const VectorBase<R>& b)
+   {
+      R dist = 0;
+
+      for(int i = 0; i < a.dim(); i++)
+      {
+         if(a[i] == b[i])
+            continue;
+
+         if(spxAbs(a[i]) >= inf || spxAbs(b[i]) >= inf)
+            dist += 1;
+         else
+            dist += spxAbs(a[i] - b[i]) / std::max(R(1), std::max(spxAbs(a[i]), spxAbs(b[i])));
+      }
+
+      return dist;
+   };
+
+   // distance between scenario s and scenario t, where index -1 denotes the real LP
+   auto scenarioDistance = [&](int s, int t)
+   {
+      const Scenario* a = (s >= 0) ? &scenarios[s] : 0;
+      const Scenario* b = &scenarios[t];
+
+      return vectorDistance((a && a->lhs.dim() > 0) ? a->lhs : baseLhs, b->lhs.dim() > 0 ? b->lhs : baseLhs)
+             + vectorDistance((a && a->rhs.dim() > 0) ? a->rhs : baseRhs, b->rhs.dim() > 0 ? b->rhs : baseRhs)
+             + vectorDistance((a && a->lower.dim() > 0) ? a->lower : baseLower,
+                              b->lower.dim() > 0 ? b->lower : baseLower)
+             + vectorDistance((a && a->upper.dim() > 0) ? a->upper : baseUpper,
+                              b->upper.dim() > 0 ? b->upper : baseUpper);
+   };
+
+   std::vector<int> unchained(nscenarios);
+   std::vector<R> dist(nscenarios);
+
+   for(int s = 0; s < nscenarios; s++)
+      unchained[s] = s;
+
+   chain.clear();
+   int current = -1;
+
+   while(!unchained.empty())
+   {
+      const int ncandidates = int(unchained.size());
+
+      spxParallelForRange(intParam(SoPlexBase<R>::THREADS), ncandidates, [&](int first, int last)
+      {
+         for(int k = first; k < last; k++)
+            dist[k] = scenarioDistance(current, unchained[k]);
+      }, 1);
+
+      // the candidates are kept in increasing order, hence the first minimum has the smallest index
+      int best = 0;
+
+      for(int k = 1; k < ncandidates; k++)
+      {
+         if(dist[k] < dist[best])
+            best = k;
+      }
+
+      current = unchained[best];
+      chain.push_back(current);
+      unchained.erase(unchained.begin() + best);
+   }
+}
+} // namespace soplex
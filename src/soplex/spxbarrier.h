@@ -0,0 +1,299 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file  spxbarrier.h
+ * @brief Primal-dual interior point method with crossover to a simplex basis.
+ */
+#ifndef _SPXBARRIER_H_
+#define _SPXBARRIER_H_
+
+#include <vector>
+
+#include "soplex/spxdefines.h"
+#include "soplex/spxout.h"
+#include "soplex/spxlpbase.h"
+#include "soplex/spxsolver.h"
+#include "soplex/spxcholesky.h"
+
+namespace soplex
+{
+
+#define SOPLEX_BARRIER_TOL          1e-8     /**< relative tolerance for infeasibilities and duality gap */
+#define SOPLEX_BARRIER_STEPFACTOR   0.995    /**< fraction of the maximal step to the boundary */
+#define SOPLEX_BARRIER_PRIMALREG    1e-12    /**< primal regularization, also bounds the scaling of free variables */
+#define SOPLEX_BARRIER_DUALREG      1e-10    /**< dual regularization added to the diagonal of the normal equations */
+#define SOPLEX_BARRIER_DIVERGE      1e30     /**< size of iterates beyond which the method is considered divergent */
+#define SOPLEX_BARRIER_STALL        20       /**< number of iterations without halving the infeasibilities and gap */
+#define SOPLEX_BARRIER_MAXNNZ       2e8      /**< maximal number of nonzeros of the Cholesky factor */
+#define SOPLEX_CROSSOVER_PIVTOL     1e-7     /**< relative pivot tolerance for selecting basic vectors */
+#define SOPLEX_CROSSOVER_MINSCORE   1.0      /**< ratio of distance to bound and dual above which vectors are always tested */
+#define SOPLEX_CROSSOVER_WORK       20.0     /**< work limit for testing other vectors, relative to the nonzeros of A and L */
+
+/**@class SPxBarrier
+   @ingroup Algo
+
+   @brief Primal-dual interior point method with crossover to a simplex basis.
+
+   The LP is transformed into the form min c^T x s.t. Ax = b, x_j >= 0 or 0 <= x_j <= u_j or x_j free, by adding a
+   slack variable for every inequality row, shifting bounds to zero and removing fixed columns and free rows.  This LP is
+   solved by Mehrotra's predictor-corrector method, which needs one factorization of the normal equations A D A^T per
+   iteration; it is computed by SPxCholesky, whose ordering and structure are computed only once.  Infeasible iterates
+   are allowed, i.e., feasibility and optimality are reached simultaneously.  The method does not detect infeasibility or
+   unboundedness; it stops if the iterates diverge or make no progress, and the caller is expected to fall back to the simplex method.
+
+   Crossover turns the interior solution into a basis of the original LP.  Every row and column is ranked by the ratio
+   of its distance to the nearest bound and the absolute value of its dual, which is large for variables that are
+   basic in an optimal basis.  In this order, vectors are added to the basis whenever they are linearly independent of
+   those selected before, which is tested exactly by a sparse left-looking LU factorization with threshold pivoting.
+   Vectors with a small ratio are only tested within a work limit, and the basis is completed by slack vectors.  All other variables become nonbasic at their nearest
+   bound.  The simplex method then removes the remaining primal and dual infeasibilities of this basis.
+
+   All computations are carried out in double precision, independently of the number type of the LP.
+*/
+template <class R>
+class SPxBarrier
+{
+public:
+
+   /// status of the interior point method
+   enum Status
+   {
+      UNKNOWN = 0,      ///< not solved yet
+      OPTIMAL,          ///< converged to an optimal solution within the tolerance
+      ITERLIMIT,        ///< stopped at the iteration limit
+      TIMELIMIT,        ///< stopped at the time limit
+      ABORTED,          ///< interrupted from outside
+      FAILED            ///< the iterates diverged or stalled, or the normal equations are too large
+   };
+
+   //-------------------------------------
+   /**@name Construction */
+   ///@{
+   /// default constructor
+   SPxBarrier()
+      : spxout(0)
+      , m_threads(1)
+      , m_iterlimit(200)
+      , m_timelimit(infinity)
+      , m_status(UNKNOWN)
+      , m_iterations(0)
+      , m_solveTime(0.0)
+      , m_crossoverTime(0.0)
+      , m_nrows(0)
+      , m_nvars(0)
+      , m_npairs(0)
+   {}
+   ///@}
+
+   //-------------------------------------
+   /**@name Settings */
+   ///@{
+   /// sets the number of threads for the normal equations and their factorization
+   void setThreads(int nthreads)
+   {
+      m_threads = MAXIMUM(1, nthreads);
+   }
+
+   /// sets the maximal number of iterations
+   void setIterationLimit(int iterlimit)
+   {
+      m_iterlimit = iterlimit;
+   }
+
+   /// sets the time limit in seconds of wall-clock time
+   void setTimeLimit(Real seconds)
+   {
+      m_timelimit = seconds;
+   }
+   ///@}
+
+   //-------------------------------------
+   /**@name Solving */
+   ///@{
+   /// solves \p lp by the interior point method; \p interrupt is polled in every iteration
+   Status solve(const SPxLPBase<R>& lp, volatile bool* interrupt = 0);
+
+   /// computes a basis of \p lp from the interior solution; returns the number of basic columns
+   /** The statuses are stored in \p rowstat and \p colstat, which must have room for all rows and columns.  solve()
+    *  must have been called on \p lp before.
+    */
+   int crossover(const SPxLPBase<R>& lp, typename SPxSolverBase<R>::VarStatus rowstat[],
+                 typename SPxSolverBase<R>::VarStatus colstat[]);
+   ///@}
+
+   //-------------------------------------
+   /**@name Inquiry */
+   ///@{
+   /// status of the last solve
+   Status status() const
+   {
+      return m_status;
+   }
+
+   /// number of iterations of the last solve
+   int iterations() const
+   {
+      return m_iterations;
+   }
+
+   /// wall-clock time of the last solve in seconds
+   Real solveTime() const
+   {
+      return m_solveTime;
+   }
+
+   /// wall-clock time of the last crossover in seconds
+   Real crossoverTime() const
+   {
+      return m_crossoverTime;
+   }
+
+   /// number of nonzeros of the Cholesky factor
+   long long factorNonzeros() const
+   {
+      return m_cholesky.numNonzeros();
+   }
+   ///@}
+
+   //-------------------------------------
+   /**@name Output */
+   ///@{
+   /// message handler
+   SPxOut* spxout;
+   ///@}
+
+private:
+
+   /// type of a variable of the transformed LP
+   enum VarType
+   {
+      LOWER = 0,        ///< x_j >= 0
+      BOXED = 1,        ///< 0 <= x_j <= u_j
+      FREE = 2          ///< x_j free
+   };
+
+   //-------------------------------------
+   /**@name Private helpers */
+   ///@{
+   /// sets up the transformed LP from \p lp
+   void setupLP(const SPxLPBase<R>& lp);
+
+   /// adds a variable with the nonzeros \p idx and \p val in the rows of \p lp, cost \p cost and bounds \p lower and
+   /// \p upper to the transformed LP; \p orig is the column, or -1 - the row of a slack variable
+   void addVar(int orig, const std::vector<int>& idx, const std::vector<Real>& val, Real cost, Real lower, Real upper);
+
+   /// sets up the pattern of the normal equations and analyzes it; returns false if the factor is too large
+   bool setupNormalEquations();
+
+   /// computes and factorizes A diag(\p theta) A^T + dual regularization
+   void factorizeNormalEquations(const std::vector<Real>& theta);
+
+   /// solves the factorized normal equations in place with one step of iterative refinement
+   void solveNormalEquations(const std::vector<Real>& theta, std::vector<Real>& rhs);
+
+   /// computes \p out = A \p in
+   void multA(const std::vector<Real>& in, std::vector<Real>& out) const;
+
+   /// computes \p out = A^T \p in
+   void multAT(const std::vector<Real>& in, std::vector<Real>& out) const;
+
+   /// computes the starting point
+   void initPoint();
+
+   /// computes the Newton direction for the complementarity targets \p rxz and \p rws
+   void newtonDirection(const std::vector<Real>& theta, const std::vector<Real>& rxz, const std::vector<Real>& rws);
+
+   /// computes the maximal primal and dual step lengths along the current direction
+   void stepLengths(Real& alphaPrimal, Real& alphaDual) const;
+   ///@}
+
+   //-------------------------------------
+   /**@name Settings and results */
+   ///@{
+   int m_threads;                      ///< number of threads
+   int m_iterlimit;                    ///< iteration limit
+   Real m_timelimit;                   ///< time limit
+   Status m_status;                    ///< status of the last solve
+   int m_iterations;                   ///< number of iterations of the last solve
+   Real m_solveTime;                   ///< time of the last solve
+   Real m_crossoverTime;               ///< time of the last crossover
+   ///@}
+
+   //-------------------------------------
+   /**@name Transformed LP */
+   ///@{
+   int m_nrows;                        ///< number of rows
+   int m_nvars;                        ///< number of variables
+   int m_npairs;                       ///< number of complementarity pairs
+   std::vector<int> m_rowOf;           ///< row of the transformed LP for each row of the LP, -1 for free rows
+   std::vector<int> m_varOf;           ///< variable for each column of the LP, -1 for fixed columns
+   std::vector<int> m_varOrig;         ///< column of the LP for each variable, -1 - the row for slack variables
+   std::vector<Real> m_varShift;       ///< value of the original variable at zero
+   std::vector<Real> m_varSign;        ///< +1 or -1 if the original variable is mirrored
+   std::vector<int> m_varType;         ///< type of each variable
+   std::vector<int> m_colBeg;          ///< column starts of A
+   std::vector<int> m_colIdx;          ///< row indices of A
+   std::vector<Real> m_colVal;         ///< values of A by columns
+   std::vector<int> m_rowBeg;          ///< row starts of A
+   std::vector<int> m_rowIdx;          ///< column indices of A
+   std::vector<Real> m_rowVal;         ///< values of A by rows
+   std::vector<Real> m_b;              ///< right-hand side
+   std::vector<Real> m_c;              ///< costs
+   std::vector<Real> m_u;              ///< upper bounds of boxed variables
+   ///@}
+
+   //-------------------------------------
+   /**@name Normal equations */
+   ///@{
+   std::vector<int> m_normBeg;         ///< column starts of the lower triangle of the normal equations
+   std::vector<int> m_normIdx;         ///< row indices of the lower triangle of the normal equations
+   std::vector<Real> m_normVal;        ///< values of the lower triangle of the normal equations
+   SPxCholesky m_cholesky;             ///< factorization of the normal equations
+   ///@}
+
+   //-------------------------------------
+   /**@name Iterates */
+   ///@{
+   std::vector<Real> m_x;              ///< primal variables
+   std::vector<Real> m_w;              ///< upper bound slacks of boxed variables
+   std::vector<Real> m_y;              ///< duals of the rows
+   std::vector<Real> m_z;              ///< duals of the lower bounds
+   std::vector<Real> m_s;              ///< duals of the upper bounds
+   std::vector<Real> m_rp;             ///< primal residual b - Ax
+   std::vector<Real> m_ru;             ///< upper bound residual u - x - w
+   std::vector<Real> m_rd;             ///< dual residual c - A^T y - z + s
+   std::vector<Real> m_dx;             ///< direction of x
+   std::vector<Real> m_dw;             ///< direction of w
+   std::vector<Real> m_dy;             ///< direction of y
+   std::vector<Real> m_dz;             ///< direction of z
+   std::vector<Real> m_ds;             ///< direction of s
+   ///@}
+};
+
+} // namespace soplex
+
+// For general templated functions
+#include "spxbarrier.hpp"
+
+#endif // _SPXBARRIER_H_
@@ -0,0 +1,1020 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <assert.h>
+
+#include "soplex/spxdefines.h"
+#include "soplex/spxthreads.h"
+
+namespace soplex
+{
+
+template <class R>
+void SPxBarrier<R>::addVar(int orig, const std::vector<int>& idx, const std::vector<Real>& val, Real cost,
+                           Real lower, Real upper)
+{
+   Real shift = 0.0;
+   Real sign = 1.0;
+   int type = FREE;
+
+   // shift finite lower bounds to zero and mirror variables with only an upper bound
+   if(lower > -infinity)
+   {
+      shift = lower;
+      type = (upper < infinity) ? BOXED : LOWER;
+   }
+   else if(upper < infinity)
+   {
+      shift = upper;
+      sign = -1.0;
+      type = LOWER;
+   }
+
+   for(size_t k = 0; k < idx.size(); ++k)
+   {
+      m_colIdx.push_back(idx[k]);
+      m_colVal.push_back(sign * val[k]);
+
+      if(shift != 0.0)
+         m_b[idx[k]] -= val[k] * shift;
+   }
+
+   m_colBeg.push_back(int(m_colIdx.size()));
+   m_c.push_back(sign * cost);
+   m_u.push_back(type == BOXED ? upper - lower : Real(infinity));
+   m_varType.push_back(type);
+   m_varShift.push_back(shift);
+   m_varSign.push_back(sign);
+   m_varOrig.push_back(orig);
+   m_npairs += (type == BOXED) ? 2 : (type == LOWER ? 1 : 0);
+   ++m_nvars;
+}
+
+
+
+template <class R>
+void SPxBarrier<R>::setupLP(const SPxLPBase<R>& lp)
+{
+   const int nrows = lp.nRows();
+   const int ncols = lp.nCols();
+
+   std::vector<Real> lhs(nrows);
+   std::vector<Real> rhs(nrows);
+
+   m_rowOf.assign(nrows, -1);
+   m_nrows = 0;
+
+   // free rows are not needed
+   for(int i = 0; i < nrows; ++i)
+   {
+      lhs[i] = (lp.lhs(i) <= R(-infinity)) ? Real(-infinity) : Real(lp.lhs(i));
+      rhs[i] = (lp.rhs(i) >= R(infinity)) ? Real(infinity) : Real(lp.rhs(i));
+
+      if(lhs[i] > -infinity || rhs[i] < infinity)
+         m_rowOf[i] = m_nrows++;
+   }
+
+   m_nvars = 0;
+   m_npairs = 0;
+   m_b.assign(m_nrows, 0.0);
+   m_c.clear();
+   m_u.clear();
+   m_varType.clear();
+   m_varShift.clear();
+   m_varSign.clear();
+   m_varOrig.clear();
+   m_colBeg.assign(1, 0);
+   m_colIdx.clear();
+   m_colVal.clear();
+
+   std::vector<int> idx(1);
+   std::vector<Real> val(1, -1.0);
+
+   // slack variables of inequality rows: a_i^T x - s_i = 0 with lhs_i <= s_i <= rhs_i
+   for(int i = 0; i < nrows; ++i)
+   {
+      const int r = m_rowOf[i];
+
+      if(r < 0)
+         continue;
+
+      if(lhs[i] == rhs[i])
+         m_b[r] = rhs[i];
+      else
+      {
+         idx[0] = r;
+         addVar(-1 - i, idx, val, 0.0, lhs[i], rhs[i]);
+      }
+   }
+
+   // structural variables; fixed columns are moved to the right-hand side
+   m_varOf.assign(ncols, -1);
+
+   for(int j = 0; j < ncols; ++j)
+   {
+      const SVectorBase<R>& col = lp.colVector(j);
+      const Real lower = (lp.lower(j) <= R(-infinity)) ? Real(-infinity) : Real(lp.lower(j));
+      const Real upper = (lp.upper(j) >= R(infinity)) ? Real(infinity) : Real(lp.upper(j));
+
+      idx.clear();
+      val.clear();
+
+      for(int k = 0; k < col.size(); ++k)
+      {
+         const int r = m_rowOf[col.index(k)];
+
+         if(r >= 0 && col.value(k) != 0)
+         {
+            idx.push_back(r);
+            val.push_back(Real(col.value(k)));
+         }
+      }
+
+      if(lower == upper)
+      {
+         for(size_t k = 0; k < idx.size(); ++k)
+            m_b[idx[k]] -= val[k] * lower;
+
+         continue;
+      }
+
+      m_varOf[j] = m_nvars;
+      addVar(j, idx, val, -Real(lp.maxObj(j)), lower, upper);
+   }
+
+   // row-wise copy of A
+   m_rowBeg.assign(m_nrows + 1, 0);
+
+   for(int q = 0; q < m_colBeg[m_nvars]; ++q)
+      ++m_rowBeg[m_colIdx[q] + 1];
+
+   for(int r = 0; r < m_nrows; ++r)
+      m_rowBeg[r + 1] += m_rowBeg[r];
+
+   std::vector<int> fill(m_rowBeg.begin(), m_rowBeg.end() - 1);
+   m_rowIdx.resize(m_colBeg[m_nvars]);
+   m_rowVal.resize(m_colBeg[m_nvars]);
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      for(int q = m_colBeg[v]; q < m_colBeg[v + 1]; ++q)
+      {
+         const int p = fill[m_colIdx[q]]++;
+         m_rowIdx[p] = v;
+         m_rowVal[p] = m_colVal[q];
+      }
+   }
+}
+
+
+
+template <class R>
+bool SPxBarrier<R>::setupNormalEquations()
+{
+   std::vector<int> mark(m_nrows, -1);
+   std::vector<int> list;
+
+   m_normBeg.assign(1, 0);
+   m_normIdx.clear();
+
+   // column k of the lower triangle of A A^T contains the rows i >= k sharing a variable with row k
+   for(int k = 0; k < m_nrows; ++k)
+   {
+      list.clear();
+      list.push_back(k);
+      mark[k] = k;
+
+      for(int p = m_rowBeg[k]; p < m_rowBeg[k + 1]; ++p)
+      {
+         const int v = m_rowIdx[p];
+
+         for(int q = m_colBeg[v]; q < m_colBeg[v + 1]; ++q)
+         {
+            const int i = m_colIdx[q];
+
+            if(i > k && mark[i] != k)
+            {
+               mark[i] = k;
+               list.push_back(i);
+            }
+         }
+      }
+
+      std::sort(list.begin(), list.end());
+      m_normIdx.insert(m_normIdx.end(), list.begin(), list.end());
+      m_normBeg.push_back(int(m_normIdx.size()));
+
+      if(Real(m_normIdx.size()) > SOPLEX_BARRIER_MAXNNZ)
+         return false;
+   }
+
+   m_normVal.resize(m_normIdx.size());
+   m_cholesky.analyze(m_nrows, m_normBeg.data(), m_normIdx.data());
+
+   return Real(m_cholesky.numNonzeros()) <= SOPLEX_BARRIER_MAXNNZ;
+}
+
+
+
+template <class R>
+void SPxBarrier<R>::factorizeNormalEquations(const std::vector<Real>& theta)
+{
+   const int nblocks = (m_threads > 1) ? MINIMUM(m_nrows, 4 * m_threads) : MINIMUM(m_nrows, 1);
+
+   // every block of columns of the normal equations is computed row-wise with its own dense work vector
+   spxParallelFor(m_threads, nblocks, [&](int b)
+   {
+      const int first = int((long long)(b) * m_nrows / nblocks);
+      const int last = int((long long)(b + 1) * m_nrows / nblocks);
+      std::vector<Real> work(m_nrows, 0.0);
+
+      for(int k = first; k < last; ++k)
+      {
+         for(int p = m_rowBeg[k]; p < m_rowBeg[k + 1]; ++p)
+         {
+            const int v = m_rowIdx[p];
+            const Real t = m_rowVal[p] * theta[v];
+
+            for(int q = m_colBeg[v]; q < m_colBeg[v + 1]; ++q)
+            {
+               if(m_colIdx[q] >= k)
+                  work[m_colIdx[q]] += t * m_colVal[q];
+            }
+         }
+
+         for(int p = m_normBeg[k]; p < m_normBeg[k + 1]; ++p)
+         {
+            m_normVal[p] = work[m_normIdx[p]];
+            work[m_normIdx[p]] = 0.0;
+         }
+
+         assert(m_normIdx[m_normBeg[k]] == k);
+         m_normVal[m_normBeg[k]] += SOPLEX_BARRIER_DUALREG;
+      }
+   });
+
+   m_cholesky.factorize(m_normVal.data(), m_threads);
+}
+
+
+
+template <class R>
+void SPxBarrier<R>::multA(const std::vector<Real>& in, std::vector<Real>& out) const
+{
+   out.assign(m_nrows, 0.0);
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      if(in[v] == 0.0)
+         continue;
+
+      for(int q = m_colBeg[v]; q < m_colBeg[v + 1]; ++q)
+         out[m_colIdx[q]] += m_colVal[q] * in[v];
+   }
+}
+
+
+
+template <class R>
+void SPxBarrier<R>::multAT(const std::vector<Real>& in, std::vector<Real>& out) const
+{
+   out.resize(m_nvars);
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      Real sum = 0.0;
+
+      for(int q = m_colBeg[v]; q < m_colBeg[v + 1]; ++q)
+         sum += m_colVal[q] * in[m_colIdx[q]];
+
+      out[v] = sum;
+   }
+}
+
+
+
+template <class R>
+void SPxBarrier<R>::solveNormalEquations(const std::vector<Real>& theta, std::vector<Real>& rhs)
+{
+   std::vector<Real> sol(rhs);
+   std::vector<Real> t;
+   std::vector<Real> res;
+
+   m_cholesky.solve(sol.data());
+
+   // one step of iterative refinement with the residual rhs - (A theta A^T + dual regularization) sol
+   multAT(sol, t);
+
+   for(int v = 0; v < m_nvars; ++v)
+      t[v] *= theta[v];
+
+   multA(t, res);
+
+   for(int i = 0; i < m_nrows; ++i)
+      res[i] = rhs[i] - res[i] - SOPLEX_BARRIER_DUALREG * sol[i];
+
+   m_cholesky.solve(res.data());
+
+   for(int i = 0; i < m_nrows; ++i)
+      rhs[i] = sol[i] + res[i];
+}
+
+
+
+/* The starting point follows Mehrotra: x is the least squares solution of Ax = b and (y, z) the least squares solution
+ * of A^T y + z = c, both shifted into the interior, and then x and z are balanced by a further shift.
+ */
+template <class R>
+void SPxBarrier<R>::initPoint()
+{
+   std::vector<Real> theta(m_nvars, 1.0);
+   std::vector<Real> t(m_b);
+   std::vector<Real> aty;
+
+   factorizeNormalEquations(theta);
+
+   solveNormalEquations(theta, t);
+   multAT(t, m_x);
+
+   multA(m_c, m_y);
+   solveNormalEquations(theta, m_y);
+   multAT(m_y, aty);
+
+   m_w.assign(m_nvars, 0.0);
+   m_z.assign(m_nvars, 0.0);
+   m_s.assign(m_nvars, 0.0);
+
+   Real minPrimal = 0.0;
+   Real minDual = 0.0;
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      const Real zt = m_c[v] - aty[v];
+
+      if(m_varType[v] == LOWER)
+      {
+         m_z[v] = zt;
+         minPrimal = MINIMUM(minPrimal, m_x[v]);
+         minDual = MINIMUM(minDual, m_z[v]);
+      }
+      else if(m_varType[v] == BOXED)
+      {
+         m_w[v] = m_u[v] - m_x[v];
+         m_z[v] = MAXIMUM(zt, Real(0.0));
+         m_s[v] = MAXIMUM(-zt, Real(0.0));
+         minPrimal = MINIMUM(minPrimal, MINIMUM(m_x[v], m_w[v]));
+      }
+   }
+
+   const Real shiftPrimal = -1.5 * minPrimal;
+   const Real shiftDual = -1.5 * minDual;
+   Real xz = 0.0;
+   Real sumPrimal = 0.0;
+   Real sumDual = 0.0;
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      if(m_varType[v] == FREE)
+         continue;
+
+      m_x[v] += shiftPrimal;
+      m_z[v] += shiftDual;
+      xz += m_x[v] * m_z[v];
+      sumPrimal += m_x[v];
+      sumDual += m_z[v];
+
+      if(m_varType[v] == BOXED)
+      {
+         m_w[v] += shiftPrimal;
+         m_s[v] += shiftDual;
+         xz += m_w[v] * m_s[v];
+         sumPrimal += m_w[v];
+         sumDual += m_s[v];
+      }
+   }
+
+   const Real balancePrimal = (xz > 0.0 && sumDual > 0.0) ? 0.5 * xz / sumDual : 0.0;
+   const Real balanceDual = (xz > 0.0 && sumPrimal > 0.0) ? 0.5 * xz / sumPrimal : 0.0;
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      if(m_varType[v] == FREE)
+         continue;
+
+      m_x[v] += balancePrimal;
+      m_z[v] += balanceDual;
+
+      if(!(m_x[v] > 0.0))
+         m_x[v] = 1.0;
+
+      if(!(m_z[v] > 0.0))
+         m_z[v] = 1.0;
+
+      if(m_varType[v] == BOXED)
+      {
+         m_w[v] += balancePrimal;
+         m_s[v] += balanceDual;
+
+         if(!(m_w[v] > 0.0))
+            m_w[v] = 1.0;
+
+         if(!(m_s[v] > 0.0))
+            m_s[v] = 1.0;
+      }
+   }
+}
+
+
+
+/* With D = Z X^{-1} + S W^{-1} + primal regularization and theta = D^{-1}, the Newton system reduces to the normal
+ * equations A theta A^T dy = rp + A theta r, where r = rd - X^{-1} rxz + W^{-1} (rws - S ru).
+ */
+template <class R>
+void SPxBarrier<R>::newtonDirection(const std::vector<Real>& theta, const std::vector<Real>& rxz,
+                                    const std::vector<Real>& rws)
+{
+   std::vector<Real> r(m_nvars);
+   std::vector<Real> t(m_nvars);
+   std::vector<Real> aty;
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      r[v] = m_rd[v];
+
+      if(m_varType[v] != FREE)
+         r[v] -= rxz[v] / m_x[v];
+
+      if(m_varType[v] == BOXED)
+         r[v] += (rws[v] - m_s[v] * m_ru[v]) / m_w[v];
+
+      t[v] = theta[v] * r[v];
+   }
+
+   multA(t, m_dy);
+
+   for(int i = 0; i < m_nrows; ++i)
+      m_dy[i] += m_rp[i];
+
+   solveNormalEquations(theta, m_dy);
+   multAT(m_dy, aty);
+
+   m_dx.resize(m_nvars);
+   m_dz.assign(m_nvars, 0.0);
+   m_dw.assign(m_nvars, 0.0);
+   m_ds.assign(m_nvars, 0.0);
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      m_dx[v] = theta[v] * (aty[v] - r[v]);
+
+      if(m_varType[v] != FREE)
+         m_dz[v] = (rxz[v] - m_z[v] * m_dx[v]) / m_x[v];
+
+      if(m_varType[v] == BOXED)
+      {
+         m_dw[v] = m_ru[v] - m_dx[v];
+         m_ds[v] = (rws[v] - m_s[v] * m_dw[v]) / m_w[v];
+      }
+   }
+}
+
+
+
+template <class R>
+void SPxBarrier<R>::stepLengths(Real& alphaPrimal, Real& alphaDual) const
+{
+   alphaPrimal = infinity;
+   alphaDual = infinity;
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      if(m_varType[v] == FREE)
+         continue;
+
+      if(m_dx[v] < 0.0)
+         alphaPrimal = MINIMUM(alphaPrimal, -m_x[v] / m_dx[v]);
+
+      if(m_dz[v] < 0.0)
+         alphaDual = MINIMUM(alphaDual, -m_z[v] / m_dz[v]);
+
+      if(m_varType[v] == BOXED)
+      {
+         if(m_dw[v] < 0.0)
+            alphaPrimal = MINIMUM(alphaPrimal, -m_w[v] / m_dw[v]);
+
+         if(m_ds[v] < 0.0)
+            alphaDual = MINIMUM(alphaDual, -m_s[v] / m_ds[v]);
+      }
+   }
+}
+
+
+
+template <class R>
+typename SPxBarrier<R>::Status SPxBarrier<R>::solve(const SPxLPBase<R>& lp, volatile bool* interrupt)
+{
+   const auto start = std::chrono::steady_clock::now();
+   auto elapsed = [&start]()
+   {
+      return std::chrono::duration<Real>(std::chrono::steady_clock::now() - start).count();
+   };
+
+   m_status = UNKNOWN;
+   m_iterations = 0;
+   m_solveTime = 0.0;
+
+   setupLP(lp);
+
+   if(!setupNormalEquations())
+   {
+      MSG_INFO1((*spxout), (*spxout) << "Barrier: normal equations too large\n");
+      m_status = FAILED;
+      m_solveTime = elapsed();
+      return m_status;
+   }
+
+   MSG_INFO1((*spxout), (*spxout) << "Barrier: " << m_nrows << " rows, " << m_nvars << " variables, "
+             << m_normIdx.size() << " nonzeros in normal equations, " << m_cholesky.numNonzeros()
+             << " nonzeros in factor\n\n"
+             << " iter |     primal obj     |      dual obj      |  p.inf  |  d.inf  |   mu    | time\n");
+
+   initPoint();
+
+   Real normb = 0.0;
+   Real normc = 0.0;
+
+   for(int i = 0; i < m_nrows; ++i)
+      normb = MAXIMUM(normb, spxAbs(m_b[i]));
+
+   for(int v = 0; v < m_nvars; ++v)
+   {
+      normc = MAXIMUM(normc, spxAbs(m_c[v]));
+
+      if(m_varType[v] == BOXED)
+         normb = MAXIMUM(normb, spxAbs(m_u[v]));
+   }
+
+   std::vector<Real> theta(m_nvars);
+   std::vector<Real> rxz(m_nvars, 0.0);
+   std::vector<Real> rws(m_nvars, 0.0);
+   std::vector<Real> aty;
+   Real bestError = infinity;
+   int bestIteration = 0;
+
+   while(m_status == UNKNOWN)
+   {
+      // residuals, objective values and complementarity
+      multA(m_x, m_rp);
+      multAT(m_y, aty);
+      m_ru.assign(m_nvars, 0.0);
+      m_rd.resize(m_nvars);
+
+      Real pinf = 0.0;
+      Real dinf = 0.0;
+      Real pobj = 0.0;
+      Real dobj = 0.0;
+      Real complementarity = 0.0;
+      Real size = 0.0;
+
+      for(int i = 0; i < m_nrows; ++i)
+      {
+         m_rp[i] = m_b[i] - m_rp[i];
+         pinf = MAXIMUM(pinf, spxAbs(m_rp[i]));
+         dobj += m_b[i] * m_y[i];
+         size = MAXIMUM(size, spxAbs(m_y[i]));
+      }
+
+      for(int v = 0; v < m_nvars; ++v)
+      {
+         m_rd[v] = m_c[v] - aty[v] - m_z[v] + m_s[v];
+         dinf = MAXIMUM(dinf, spxAbs(m_rd[v]));
+         pobj += m_c[v] * m_x[v];
+         complementarity += m_x[v] * m_z[v];
+         size = MAXIMUM(size, spxAbs(m_x[v]));
+
+         if(m_varType[v] == BOXED)
+         {
+            m_ru[v] = m_u[v] - m_x[v] - m_w[v];
+            pinf = MAXIMUM(pinf, spxAbs(m_ru[v]));
+            dobj -= m_u[v] * m_s[v];
+            complementarity += m_w[v] * m_s[v];
+         }
+      }
+
+      const Real mu = complementarity / MAXIMUM(m_npairs, 1);
+      const Real relgap = spxAbs(pobj - dobj) / (1.0 + spxAbs(pobj));
+
+      pinf /= 1.0 + normb;
+      dinf /= 1.0 + normc;
+
+      MSG_INFO1((*spxout), (*spxout) << std::setw(5) << m_iterations << " | " << std::scientific
+                << std::setprecision(12) << std::setw(18) << pobj << " | " << std::setw(18) << dobj << " | "
+                << std::setprecision(1) << pinf << " | " << dinf << " | " << mu << " | " << std::fixed
+                << std::setprecision(2) << elapsed() << "\n" << std::defaultfloat);
+
+      // infeasible LPs typically lead to iterates that stall or diverge
+      const Real error = MAXIMUM(MAXIMUM(pinf, dinf), relgap);
+
+      if(error <= 0.5 * bestError)
+      {
+         bestError = error;
+         bestIteration = m_iterations;
+      }
+
+      if(pinf <= SOPLEX_BARRIER_TOL && dinf <= SOPLEX_BARRIER_TOL && relgap <= SOPLEX_BARRIER_TOL)
+         m_status = OPTIMAL;
+      else if(!(size < SOPLEX_BARRIER_DIVERGE) || !(mu < SOPLEX_BARRIER_DIVERGE)
+              || m_iterations - bestIteration >= SOPLEX_BARRIER_STALL)
+         m_status = FAILED;
+      else if(m_iterations >= m_iterlimit)
+         m_status = ITERLIMIT;
+      else if(elapsed() >= m_timelimit)
+         m_status = TIMELIMIT;
+      else if(interrupt != 0 && *interrupt)
+         m_status = ABORTED;
+
+      if(m_status != UNKNOWN)
+         break;
+
+      for(int v = 0; v < m_nvars; ++v)
+      {
+         Real d = SOPLEX_BARRIER_PRIMALREG;
+
+         if(m_varType[v] != FREE)
+            d += m_z[v] / m_x[v];
+
+         if(m_varType[v] == BOXED)
+            d += m_s[v] / m_w[v];
+
+         theta[v] = 1.0 / d;
+      }
+
+      factorizeNormalEquations(theta);
+
+      // predictor: affine scaling direction
+      for(int v = 0; v < m_nvars; ++v)
+      {
+         rxz[v] = (m_varType[v] != FREE) ? -m_x[v] * m_z[v] : 0.0;
+         rws[v] = (m_varType[v] == BOXED) ? -m_w[v] * m_s[v] : 0.0;
+      }
+
+      newtonDirection(theta, rxz, rws);
+
+      Real alphaPrimal;
+      Real alphaDual;
+      stepLengths(alphaPrimal, alphaDual);
+      alphaPrimal = MINIMUM(alphaPrimal, Real(1.0));
+      alphaDual = MINIMUM(alphaDual, Real(1.0));
+
+      Real complAff = 0.0;
+
+      for(int v = 0; v < m_nvars; ++v)
+      {
+         if(m_varType[v] != FREE)
+            complAff += (m_x[v] + alphaPrimal * m_dx[v]) * (m_z[v] + alphaDual * m_dz[v]);
+
+         if(m_varType[v] == BOXED)
+            complAff += (m_w[v] + alphaPrimal * m_dw[v]) * (m_s[v] + alphaDual * m_ds[v]);
+      }
+
+      const Real muAff = complAff / MAXIMUM(m_npairs, 1);
+      const Real sigma = (mu > 0.0) ? MINIMUM(Real(1.0), std::pow(muAff / mu, 3)) : 0.0;
+
+      // corrector: centering towards sigma mu and second order correction of the complementarity
+      for(int v = 0; v < m_nvars; ++v)
+      {
+         if(m_varType[v] != FREE)
+            rxz[v] = sigma * mu - m_x[v] * m_z[v] - m_dx[v] * m_dz[v];
+
+         if(m_varType[v] == BOXED)
+            rws[v] = sigma * mu - m_w[v] * m_s[v] - m_dw[v] * m_ds[v];
+      }
+
+      newtonDirection(theta, rxz, rws);
+      stepLengths(alphaPrimal, alphaDual);
+      alphaPrimal = MINIMUM(SOPLEX_BARRIER_STEPFACTOR * alphaPrimal, Real(1.0));
+      alphaDual = MINIMUM(SOPLEX_BARRIER_STEPFACTOR * alphaDual, Real(1.0));
+
+      for(int v = 0; v < m_nvars; ++v)
+      {
+         m_x[v] += alphaPrimal * m_dx[v];
+         m_w[v] += alphaPrimal * m_dw[v];
+         m_z[v] += alphaDual * m_dz[v];
+         m_s[v] += alphaDual * m_ds[v];
+      }
+
+      for(int i = 0; i < m_nrows; ++i)
+         m_y[i] += alphaDual * m_dy[i];
+
+      ++m_iterations;
+   }
+
+   m_solveTime = elapsed();
+
+   MSG_INFO1((*spxout), (*spxout) << "\nBarrier: " << (m_status == OPTIMAL ? "converged" : "stopped") << " after "
+             << m_iterations << " iterations and " << std::fixed << std::setprecision(2) << m_solveTime
+             << " seconds\n" << std::defaultfloat);
+
+   return m_status;
+}
+
+
+
+/* The basis is built greedily as B = L U: for every candidate vector v in the order of the ranking, the triangular
+ * system with the L vectors of the previously selected vectors is solved, where only the L vectors reachable from the
+ * nonzeros of v are applied, in topological order, as in the left-looking LU factorization of Gilbert and Peierls.  If
+ * the remaining entries in rows without pivot contain one of sufficient size, v is selected and the largest of them
+ * becomes its pivot.  Vectors with a ratio below SOPLEX_CROSSOVER_MINSCORE are only tested until the total size of the
+ * reaches exceeds a limit, since most of them are dependent at the end of the ranking, and testing them would dominate
+ * the running time.
+ */
+template <class R>
+int SPxBarrier<R>::crossover(const SPxLPBase<R>& lp, typename SPxSolverBase<R>::VarStatus rowstat[],
+                             typename SPxSolverBase<R>::VarStatus colstat[])
+{
+   const auto start = std::chrono::steady_clock::now();
+   const int nrows = lp.nRows();
+   const int ncols = lp.nCols();
+   const Real tiny = 1e-14;
+
+   std::vector<Real> lower(ncols);
+   std::vector<Real> upper(ncols);
+   std::vector<Real> lhs(nrows);
+   std::vector<Real> rhs(nrows);
+   std::vector<Real> x(ncols);
+   std::vector<Real> activity(nrows, 0.0);
+   std::vector<Real> dual(nrows, 0.0);
+   std::vector<Real> score(ncols + nrows);
+
+   assert(m_status == OPTIMAL);
+
+   for(int i = 0; i < nrows; ++i)
+   {
+      lhs[i] = (lp.lhs(i) <= R(-infinity)) ? Real(-infinity) : Real(lp.lhs(i));
+      rhs[i] = (lp.rhs(i) >= R(infinity)) ? Real(infinity) : Real(lp.rhs(i));
+      dual[i] = (m_rowOf[i] >= 0) ? m_y[m_rowOf[i]] : 0.0;
+   }
+
+   // primal solution, activities and ranking of the columns
+   for(int j = 0; j < ncols; ++j)
+   {
+      const SVectorBase<R>& col = lp.colVector(j);
+      const int v = m_varOf[j];
+      Real redcost = -Real(lp.maxObj(j));
+
+      lower[j] = (lp.lower(j) <= R(-infinity)) ? Real(-infinity) : Real(lp.lower(j));
+      upper[j] = (lp.upper(j) >= R(infinity)) ? Real(infinity) : Real(lp.upper(j));
+      x[j] = (v >= 0) ? m_varShift[v] + m_varSign[v] * m_x[v] : lower[j];
+
+      for(int k = 0; k < col.size(); ++k)
+      {
+         activity[col.index(k)] += Real(col.value(k)) * x[j];
+         redcost -= Real(col.value(k)) * dual[col.index(k)];
+      }
+
+      if(v < 0)
+         score[j] = -2.0;
+      else
+      {
+         const Real dist = MINIMUM(x[j] - lower[j], upper[j] - x[j]);
+         score[j] = (dist >= infinity) ? Real(infinity) : MAXIMUM(dist, Real(0.0)) / (spxAbs(redcost) + tiny);
+      }
+   }
+
+   // ranking of the slacks; slacks of equality rows complete the basis before fixed columns
+   for(int i = 0; i < nrows; ++i)
+   {
+      if(lhs[i] == rhs[i])
+         score[ncols + i] = -1.0;
+      else
+      {
+         const Real dist = MINIMUM(activity[i] - lhs[i], rhs[i] - activity[i]);
+         score[ncols + i] = (dist >= infinity) ? Real(infinity) : MAXIMUM(dist, Real(0.0)) / (spxAbs(dual[i]) + tiny);
+      }
+   }
+
+   std::vector<int> order(ncols + nrows);
+
+   for(int k = 0; k < ncols + nrows; ++k)
+      order[k] = k;
+
+   std::stable_sort(order.begin(), order.end(), [&score](int a, int b)
+   {
+      return score[a] > score[b];
+   });
+
+   // greedy selection of linearly independent vectors
+   std::vector<int> pivotOf(nrows, -1);
+   std::vector<int> lbeg(1, 0);
+   std::vector<int> lidx;
+   std::vector<Real> lval;
+   std::vector<Real> work(nrows, 0.0);
+   std::vector<int> visited(nrows, -1);
+   std::vector<int> topo;
+   std::vector<std::pair<int, int> > stack;
+   std::vector<int> vecIdx;
+   std::vector<Real> vecVal;
+   std::vector<bool> basic(ncols + nrows, false);
+   int npivots = 0;
+   int nbasicCols = 0;
+
+   const Real budget = SOPLEX_CROSSOVER_WORK * Real(m_colBeg[m_nvars] + m_cholesky.numNonzeros());
+   Real effort = 0.0;
+
+   for(int k = 0; k < ncols + nrows && npivots < nrows; ++k)
+   {
+      const int cand = order[k];
+
+      if(score[cand] <= SOPLEX_CROSSOVER_MINSCORE && effort > budget)
+         break;
+
+      vecIdx.clear();
+      vecVal.clear();
+
+      if(cand < ncols)
+      {
+         const SVectorBase<R>& col = lp.colVector(cand);
+
+         for(int p = 0; p < col.size(); ++p)
+         {
+            if(col.value(p) != 0)
+            {
+               vecIdx.push_back(col.index(p));
+               vecVal.push_back(Real(col.value(p)));
+            }
+         }
+      }
+      else
+      {
+         vecIdx.push_back(cand - ncols);
+         vecVal.push_back(1.0);
+      }
+
+      if(vecIdx.empty())
+         continue;
+
+      // rows reachable from the nonzeros of the vector through the L vectors, in postorder of a depth-first search
+      topo.clear();
+
+      for(int r : vecIdx)
+      {
+         if(visited[r] == k)
+            continue;
+
+         visited[r] = k;
+         stack.push_back(std::make_pair(r, 0));
+
+         while(!stack.empty())
+         {
+            const int row = stack.back().first;
+            const int piv = pivotOf[row];
+
+            if(piv >= 0 && lbeg[piv] + stack.back().second < lbeg[piv + 1])
+            {
+               const int child = lidx[lbeg[piv] + stack.back().second];
+               ++stack.back().second;
+
+               if(visited[child] != k)
+               {
+                  visited[child] = k;
+                  stack.push_back(std::make_pair(child, 0));
+               }
+            }
+            else
+            {
+               topo.push_back(row);
+               stack.pop_back();
+            }
+         }
+      }
+
+      effort += Real(topo.size());
+
+      Real vmax = 0.0;
+
+      for(size_t p = 0; p < vecIdx.size(); ++p)
+      {
+         work[vecIdx[p]] = vecVal[p];
+         vmax = MAXIMUM(vmax, spxAbs(vecVal[p]));
+      }
+
+      for(int t = int(topo.size()) - 1; t >= 0; --t)
+      {
+         const int piv = pivotOf[topo[t]];
+         const Real val = work[topo[t]];
+
+         if(piv < 0 || val == 0.0)
+            continue;
+
+         for(int p = lbeg[piv]; p < lbeg[piv + 1]; ++p)
+            work[lidx[p]] -= lval[p] * val;
+      }
+
+      int pivotRow = -1;
+      Real pivotVal = 0.0;
+
+      for(int row : topo)
+      {
+         if(pivotOf[row] < 0 && spxAbs(work[row]) > spxAbs(pivotVal))
+         {
+            pivotRow = row;
+            pivotVal = work[row];
+         }
+      }
+
+      if(pivotRow >= 0 && spxAbs(pivotVal) > SOPLEX_CROSSOVER_PIVTOL * vmax)
+      {
+         for(int row : topo)
+         {
+            if(pivotOf[row] < 0 && row != pivotRow && work[row] != 0.0)
+            {
+               lidx.push_back(row);
+               lval.push_back(work[row] / pivotVal);
+            }
+         }
+
+         lbeg.push_back(int(lidx.size()));
+         pivotOf[pivotRow] = npivots++;
+         basic[cand] = true;
+         nbasicCols += (cand < ncols) ? 1 : 0;
+      }
+
+      for(int row : topo)
+         work[row] = 0.0;
+   }
+
+   // the basis is completed by the slacks of the rows without pivot, which are independent of the selected vectors
+   for(int i = 0; i < nrows; ++i)
+   {
+      if(pivotOf[i] < 0)
+      {
+         pivotOf[i] = npivots++;
+         basic[ncols + i] = true;
+      }
+   }
+
+   assert(npivots == nrows);
+
+   // nonbasic variables are set to their nearest bound
+   for(int j = 0; j < ncols; ++j)
+   {
+      if(basic[j])
+         colstat[j] = SPxSolverBase<R>::BASIC;
+      else if(lower[j] == upper[j])
+         colstat[j] = SPxSolverBase<R>::FIXED;
+      else if(lower[j] > -infinity && (upper[j] >= infinity || x[j] - lower[j] <= upper[j] - x[j]))
+         colstat[j] = SPxSolverBase<R>::ON_LOWER;
+      else if(upper[j] < infinity)
+         colstat[j] = SPxSolverBase<R>::ON_UPPER;
+      else
+         colstat[j] = SPxSolverBase<R>::ZERO;
+   }
+
+   for(int i = 0; i < nrows; ++i)
+   {
+      if(basic[ncols + i])
+         rowstat[i] = SPxSolverBase<R>::BASIC;
+      else if(lhs[i] == rhs[i])
+         rowstat[i] = SPxSolverBase<R>::FIXED;
+      else if(lhs[i] > -infinity && (rhs[i] >= infinity || activity[i] - lhs[i] <= rhs[i] - activity[i]))
+         rowstat[i] = SPxSolverBase<R>::ON_LOWER;
+      else if(rhs[i] < infinity)
+         rowstat[i] = SPxSolverBase<R>::ON_UPPER;
+      else
+         rowstat[i] = SPxSolverBase<R>::ZERO;
+   }
+
+   m_crossoverTime = std::chrono::duration<Real>(std::chrono::steady_clock::now() - start).count();
+
+   MSG_INFO1((*spxout), (*spxout) << "Crossover: " << nbasicCols << " basic columns, " << nrows - nbasicCols
+             << " basic slacks, " << std::fixed << std::setprecision(2) << m_crossoverTime << " seconds\n\n" << std::defaultfloat);
+
+   return nbasicCols;
+}
+
+} // namespace soplex
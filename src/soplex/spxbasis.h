@@ -628,10 +628,18 @@ public:
       return condition(1000, 1e-9);
    }
 
+   /* compute an estimate of the 1-norm condition number of the current basis matrix.
+    * The 1-norm of B is computed exactly, the 1-norm of B^-1 is estimated by the block method of Higham and Tisseur,
+    * which performs up to maxiters iterations of blocksize solves with B and B^T each.  The estimate is a lower bound
+    * on the condition number and rarely off by more than a factor of three.
+    */
+   R conditionOneNorm(int blocksize = 2, int maxiters = 5);
+
    /** compute one of several matrix metrics based on the diagonal of the LU factorization
      * type = 0: max/min ratio
      * type = 1: trace of U (sum of diagonal elements)
     *  type = 2: determinant (product of diagonal elements)
+     * type = 3: estimated 1-norm condition number, see conditionOneNorm()
      */
    R getMatrixMetric(int type = 0);
 
@@ -27,12 +27,15 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
+#include <vector>
 
 #include "soplex/spxdefines.h"
 #include "soplex/didxset.h"
 #include "soplex/mpsinput.h"
 #include "soplex/spxout.h"
 #include "soplex/exceptions.h"
+#include "soplex/random.h"
 
 namespace soplex
 {
@@ -1203,6 +1206,237 @@ R SPxBasisBase<R>::condition(int maxiters, R tolerance)
    return norm * norminv;
 }
 
+/* compute an estimate of the 1-norm condition number of the current basis matrix by the block 1-norm estimator of
+ * Higham and Tisseur (Algorithm 2.4 in "A block algorithm for matrix 1-norm estimation, with an application to
+ * 1-norm pseudospectra", SIAM J. Matrix Anal. Appl. 21(4), 2000), which generalizes Hager's method to blocks of
+ * blocksize vectors.  Random columns of the starting block are drawn with a fixed seed, such that the estimate is
+ * deterministic.
+ */
+template <class R>
+R SPxBasisBase<R>::conditionOneNorm(int blocksize, int maxiters)
+{
+   int dimension = matrix.size();
+
+   // catch corner case of empty matrix
+   if(dimension <= 0)
+      return 1.0;
+
+   // check whether a regular basis matrix is available
+   if(status() < REGULAR)
+      return 0;
+
+   if(!matrixIsSetup)
+      (const_cast<SPxBasisBase<R>*>(this))->loadDesc(thedesc);
+
+   if(!factorized)
+      factorize();
+
+   // compute the 1-norm of B, i.e., the maximum absolute sum of the basis vectors
+   R norm = 0.0;
+
+   for(int i = 0; i < dimension; ++i)
+   {
+      const SVectorBase<R>& vec = *matrix[i];
+      R sum = 0.0;
+
+      for(int k = 0; k < vec.size(); ++k)
+         sum += spxAbs(vec.value(k));
+
+      if(sum > norm)
+         norm = sum;
+   }
+
+   int t = MAXIMUM(1, MINIMUM(blocksize, dimension));
+   int ncols = t;
+   int noldcols = 0;
+   int best = -1;
+   R est = 0.0;
+   R estold = 0.0;
+   R scale = R(1.0) / R(dimension);
+   Random rnd(static_cast<uint32_t>(dimension));
+
+   std::vector<VectorBase<R> > X(t, VectorBase<R>(dimension));
+   std::vector<VectorBase<R> > Y(t, VectorBase<R>(dimension));
+   std::vector<VectorBase<R> > S(t, VectorBase<R>(dimension));
+   std::vector<VectorBase<R> > Sold(t, VectorBase<R>(dimension));
+   VectorBase<R> z(dimension);
+   std::vector<R> h(dimension);
+   std::vector<int> ind(t, -1);
+   std::vector<int> order(dimension);
+   std::vector<bool> visited(dimension, false);
+
+   // two sign vectors are parallel if they agree or disagree in all entries
+   auto parallel = [dimension](const VectorBase<R>& a, const VectorBase<R>& b)
+   {
+      bool equal = true;
+      bool opposite = true;
+
+      for(int i = 0; i < dimension && (equal || opposite); ++i)
+      {
+         if(a[i] == b[i])
+            opposite = false;
+         else
+            equal = false;
+      }
+
+      return equal || opposite;
+   };
+
+   // is v parallel to one of the first n vectors of vecs?
+   auto parallelToAny = [&parallel](const VectorBase<R>& v, const std::vector<VectorBase<R> >& vecs, int n)
+   {
+      for(int k = 0; k < n; ++k)
+      {
+         if(parallel(v, vecs[k]))
+            return true;
+      }
+
+      return false;
+   };
+
+   // fills v with random signs
+   auto randomize = [&rnd, dimension](VectorBase<R>& v, R value)
+   {
+      for(int i = 0; i < dimension; ++i)
+         v[i] = (rnd.next() < 0.5) ? -value : value;
+   };
+
+   // the first column of the starting block is the vector of all ones, the others have random signs; all columns
+   // are scaled to unit 1-norm
+   for(int i = 0; i < dimension; ++i)
+      X[0][i] = scale;
+
+   for(int j = 1; j < t; ++j)
+   {
+      int tries = 0;
+
+      do
+      {
+         randomize(X[j], scale);
+         ++tries;
+      }
+      while(tries < 10 && parallelToAny(X[j], X, j));
+   }
+
+   for(int iter = 0; iter < maxiters; ++iter)
+   {
+      // Y = B^-1 X, the estimate is the largest 1-norm of a column of Y
+      int bestcol = 0;
+      est = 0.0;
+
+      for(int j = 0; j < ncols; ++j)
+      {
+         factor->solveRight(Y[j], X[j]);
+         R colnorm = 0.0;
+
+         for(int i = 0; i < dimension; ++i)
+            colnorm += spxAbs(Y[j][i]);
+
+         if(colnorm > est)
+         {
+            est = colnorm;
+            bestcol = j;
+         }
+      }
+
+      // stop if the estimate did not increase
+      if(iter > 0 && est <= estold)
+      {
+         est = estold;
+         break;
+      }
+
+      estold = est;
+
+      if(iter > 0)
+         best = ind[bestcol];
+
+      if(iter == maxiters - 1)
+         break;
+
+      // S = sign(Y); stop if all columns of S are parallel to columns of the previous S
+      bool allparallel = (iter > 0);
+
+      for(int j = 0; j < ncols; ++j)
+      {
+         for(int i = 0; i < dimension; ++i)
+            S[j][i] = (Y[j][i] < 0) ? -1.0 : 1.0;
+
+         if(allparallel && !parallelToAny(S[j], Sold, noldcols))
+            allparallel = false;
+      }
+
+      if(allparallel)
+         break;
+
+      // make the columns of S pairwise non-parallel and non-parallel to the previous S
+      for(int j = 1; j < ncols; ++j)
+      {
+         int tries = 0;
+
+         while(tries < 10 && (parallelToAny(S[j], S, j) || parallelToAny(S[j], Sold, noldcols)))
+         {
+            randomize(S[j], 1.0);
+            ++tries;
+         }
+      }
+
+      // h_i = max_j |(B^-T S)_ij|; stop if the maximum is attained at the unit vector that gave the best estimate
+      std::fill(h.begin(), h.end(), R(0.0));
+
+      for(int j = 0; j < ncols; ++j)
+      {
+         factor->solveLeft(z, S[j]);
+
+         for(int i = 0; i < dimension; ++i)
+            h[i] = MAXIMUM(h[i], R(spxAbs(z[i])));
+      }
+
+      R hmax = *std::max_element(h.begin(), h.end());
+
+      if(iter > 0 && hmax <= h[best])
+         break;
+
+      // the next block consists of the unit vectors of the t largest entries of h that have not been used before
+      for(int i = 0; i < dimension; ++i)
+         order[i] = i;
+
+      std::stable_sort(order.begin(), order.end(), [&h](int a, int b)
+      {
+         return h[a] > h[b];
+      });
+
+      bool allvisited = true;
+
+      for(int k = 0; k < t && allvisited; ++k)
+         allvisited = visited[order[k]];
+
+      if(allvisited)
+         break;
+
+      std::swap(S, Sold);
+      noldcols = ncols;
+      ncols = 0;
+
+      for(int k = 0; k < dimension && ncols < t; ++k)
+      {
+         if(visited[order[k]])
+            continue;
+
+         ind[ncols] = order[k];
+         visited[order[k]] = true;
+         X[ncols].clear();
+         X[ncols][order[k]] = 1.0;
+         ++ncols;
+      }
+
+      if(ncols == 0)
+         break;
+   }
+
+   return norm * est;
+}
+
 /* compute one of several matrix metrics based on the diagonal of the LU factorization */
 template <class R>
 R SPxBasisBase<R>::getMatrixMetric(int type)
@@ -1210,7 +1444,7 @@ R SPxBasisBase<R>::getMatrixMetric(int type)
    R metric = R(infinity);
 
    if(factorized)
-      metric = factor->matrixMetric(type);
+      metric = (type == 3) ? conditionOneNorm() : factor->matrixMetric(type);
 
    return metric;
 }
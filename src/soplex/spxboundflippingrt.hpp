@@ -504,6 +504,7 @@ bool SPxBoundFlippingRT<R>::getData(
             this->thesolver->theShift += low[idx] - vec[idx];
 
          this->thesolver->upBound()[idx] = this->thesolver->lpBound()[idx] = vec[idx];
+         this->thesolver->markShifted(this->thesolver->upBound(), idx);
       }
       else if((max > 0 && val < -degeneps) || (max < 0 && val > degeneps))
       {
@@ -538,6 +539,7 @@ bool SPxBoundFlippingRT<R>::getData(
             this->thesolver->theShift += low[idx] - vec[idx];
 
          this->thesolver->ucBound()[idx] = this->thesolver->lcBound()[idx] = vec[idx];
+         this->thesolver->markShifted(this->thesolver->ucBound(), idx);
       }
       else if((max > 0 && val < -degeneps) || (max < 0 && val > degeneps))
       {
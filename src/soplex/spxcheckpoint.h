@@ -0,0 +1,310 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file  spxcheckpoint.h
+ * @brief Checkpoints of a running simplex solve and binary warm-start files.
+ *
+ * A checkpoint stores the basis, the dual norms of the pricer and the progress of a simplex solve in a compact binary
+ * file, from which a later solve of the same LP can be resumed.  The same format serves as warm-start file, which is
+ * loaded in a single read without resolving row and column names.  The file consists of the header "SPXCKPT", a
+ * format version, the dimensions and number of nonzeros of the LP, the simplex type and representation, the iteration
+ * count, the basis status of every row and column as one byte each, the dual norms as doubles, and optionally the
+ * scaling exponents of the rows and columns the norms refer to.  All numbers are written in the byte order of the
+ * machine.
+ */
+
+#ifndef _SPXCHECKPOINT_H_
+#define _SPXCHECKPOINT_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "soplex/spxdefines.h"
+
+namespace soplex
+{
+
+/// format version of checkpoint files
+#define SOPLEX_CHECKPOINT_VERSION 1
+
+/// data of a checkpoint or warm-start file
+struct SPxCheckpointData
+{
+   int nRows;                             ///< number of rows of the LP
+   int nCols;                             ///< number of columns of the LP
+   int nNzos;                             ///< number of nonzeros of the LP
+   int type;                              ///< simplex type, see SPxSolverBase::Type
+   int rep;                               ///< basis representation, see SPxSolverBase::Representation
+   long long iteration;                   ///< number of iterations performed when the checkpoint was taken
+   int nNormsRow;                         ///< number of row norms
+   int nNormsCol;                         ///< number of column norms
+   std::vector<signed char> rowStatus;    ///< basis status of the rows, see SPxSolverBase::VarStatus
+   std::vector<signed char> colStatus;    ///< basis status of the columns, see SPxSolverBase::VarStatus
+   std::vector<double> norms;             ///< row norms followed by column norms
+   std::vector<int> rowScaleExp;          ///< scaling exponents of the rows, empty if the LP was not scaled
+   std::vector<int> colScaleExp;          ///< scaling exponents of the columns, empty if the LP was not scaled
+
+   SPxCheckpointData()
+      : nRows(0)
+      , nCols(0)
+      , nNzos(0)
+      , type(0)
+      , rep(0)
+      , iteration(0)
+      , nNormsRow(0)
+      , nNormsCol(0)
+   {}
+
+   /// writes the checkpoint to \p filename; the file is written under a temporary name first and renamed afterwards,
+   /// such that an interrupted write never destroys the previous checkpoint
+   bool writeFile(const std::string& filename) const
+   {
+      const std::string tmpname = filename + ".tmp";
+      std::ofstream ofs(tmpname.c_str(), std::ios::binary | std::ios::trunc);
+
+      if(!ofs)
+         return false;
+
+      const int version = SOPLEX_CHECKPOINT_VERSION;
+      const int nRowScaleExp = int(rowScaleExp.size());
+      const int nColScaleExp = int(colScaleExp.size());
+
+      ofs.write("SPXCKPT", 8);
+      writeValue(ofs, version);
+      writeValue(ofs, nRows);
+      writeValue(ofs, nCols);
+      writeValue(ofs, nNzos);
+      writeValue(ofs, type);
+      writeValue(ofs, rep);
+      writeValue(ofs, iteration);
+      writeValue(ofs, nNormsRow);
+      writeValue(ofs, nNormsCol);
+      writeValue(ofs, nRowScaleExp);
+      writeValue(ofs, nColScaleExp);
+      ofs.write(reinterpret_cast<const char*>(rowStatus.data()), std::streamsize(rowStatus.size()));
+      ofs.write(reinterpret_cast<const char*>(colStatus.data()), std::streamsize(colStatus.size()));
+      ofs.write(reinterpret_cast<const char*>(norms.data()), std::streamsize(norms.size() * sizeof(double)));
+      ofs.write(reinterpret_cast<const char*>(rowScaleExp.data()), std::streamsize(rowScaleExp.size() * sizeof(int)));
+      ofs.write(reinterpret_cast<const char*>(colScaleExp.data()), std::streamsize(colScaleExp.size() * sizeof(int)));
+      ofs.close();
+
+      if(!ofs)
+      {
+         std::remove(tmpname.c_str());
+         return false;
+      }
+
+      return std::rename(tmpname.c_str(), filename.c_str()) == 0;
+   }
+
+   /// reads a checkpoint from \p filename; returns false if the file cannot be read or has a different format
+   bool readFile(const std::string& filename)
+   {
+      std::ifstream ifs(filename.c_str(), std::ios::binary);
+      char header[8];
+      int version = 0;
+      int nRowScaleExp = 0;
+      int nColScaleExp = 0;
+
+      if(!ifs || !ifs.read(header, 8) || std::string(header, 7) != "SPXCKPT" || !readValue(ifs, version)
+            || version != SOPLEX_CHECKPOINT_VERSION)
+         return false;
+
+      if(!readValue(ifs, nRows) || !readValue(ifs, nCols) || !readValue(ifs, nNzos) || !readValue(ifs, type)
+            || !readValue(ifs, rep) || !readValue(ifs, iteration) || !readValue(ifs, nNormsRow)
+            || !readValue(ifs, nNormsCol) || !readValue(ifs, nRowScaleExp) || !readValue(ifs, nColScaleExp)
+            || nRows < 0 || nCols < 0 || nNormsRow < 0 || nNormsCol < 0 || nNormsRow > nRows + nCols
+            || nNormsCol > nRows + nCols || (nRowScaleExp != 0 && nRowScaleExp != nRows)
+            || (nColScaleExp != 0 && nColScaleExp != nCols))
+         return false;
+
+      rowStatus.resize(nRows);
+      colStatus.resize(nCols);
+      norms.resize(size_t(nNormsRow) + size_t(nNormsCol));
+      rowScaleExp.resize(nRowScaleExp);
+      colScaleExp.resize(nColScaleExp);
+
+      ifs.read(reinterpret_cast<char*>(rowStatus.data()), std::streamsize(rowStatus.size()));
+      ifs.read(reinterpret_cast<char*>(colStatus.data()), std::streamsize(colStatus.size()));
+      ifs.read(reinterpret_cast<char*>(norms.data()), std::streamsize(norms.size() * sizeof(double)));
+      ifs.read(reinterpret_cast<char*>(rowScaleExp.data()), std::streamsize(rowScaleExp.size() * sizeof(int)));
+      ifs.read(reinterpret_cast<char*>(colScaleExp.data()), std::streamsize(colScaleExp.size() * sizeof(int)));
+
+      return bool(ifs);
+   }
+
+private:
+
+   template <class T>
+   static void writeValue(std::ofstream& ofs, const T& val)
+   {
+      ofs.write(reinterpret_cast<const char*>(&val), sizeof(T));
+   }
+
+   template <class T>
+   static bool readValue(std::ifstream& ifs, T& val)
+   {
+      return bool(ifs.read(reinterpret_cast<char*>(&val), sizeof(T)));
+   }
+};
+
+
+/// writes checkpoints of a simplex solve periodically on a background thread
+/**
+ *  The solver decides with isDue() in every iteration whether a checkpoint should be taken, collects the data and
+ *  hands it over to write().  Writing happens on a background thread, so the solve only pays for copying the basis and
+ *  the norms.  If the previous checkpoint is still being written, the new one is skipped.  Copies of a writer share the
+ *  settings, but not the background thread.
+ */
+class SPxCheckpointWriter
+{
+public:
+
+   SPxCheckpointWriter()
+      : iterInterval(0)
+      , timeInterval(0.0)
+      , lastIteration(0)
+      , busy(false)
+      , nWritten(0)
+   {}
+
+   SPxCheckpointWriter(const SPxCheckpointWriter& other)
+      : filename(other.filename)
+      , iterInterval(other.iterInterval)
+      , timeInterval(other.timeInterval)
+      , lastIteration(0)
+      , busy(false)
+      , nWritten(0)
+   {}
+
+   SPxCheckpointWriter& operator=(const SPxCheckpointWriter& other)
+   {
+      if(this != &other)
+      {
+         wait();
+         filename = other.filename;
+         iterInterval = other.iterInterval;
+         timeInterval = other.timeInterval;
+      }
+
+      return *this;
+   }
+
+   ~SPxCheckpointWriter()
+   {
+      wait();
+   }
+
+   /// writes checkpoints to \p name every \p iterations iterations and every \p seconds seconds; an empty name or
+   /// nonpositive intervals disable checkpointing
+   void setup(const std::string& name, int iterations, double seconds)
+   {
+      wait();
+      filename = name;
+      iterInterval = iterations;
+      timeInterval = seconds;
+   }
+
+   /// are checkpoints written?
+   bool isActive() const
+   {
+      return !filename.empty() && (iterInterval > 0 || timeInterval > 0.0);
+   }
+
+   /// name of the checkpoint file
+   const std::string& fileName() const
+   {
+      return filename;
+   }
+
+   /// number of checkpoints written so far
+   int numWritten() const
+   {
+      return nWritten;
+   }
+
+   /// restarts the intervals at the beginning of a solve
+   void start()
+   {
+      lastIteration = 0;
+      lastTime = std::chrono::steady_clock::now();
+   }
+
+   /// is a checkpoint due after \p iteration iterations?
+   bool isDue(long long iteration) const
+   {
+      if(!isActive() || busy)
+         return false;
+
+      if(iterInterval > 0 && iteration - lastIteration >= iterInterval)
+         return true;
+
+      return timeInterval > 0.0
+             && std::chrono::duration<double>(std::chrono::steady_clock::now() - lastTime).count() >= timeInterval;
+   }
+
+   /// writes \p data on the background thread
+   void write(SPxCheckpointData&& data)
+   {
+      wait();
+
+      lastIteration = data.iteration;
+      lastTime = std::chrono::steady_clock::now();
+      busy = true;
+
+      worker = std::thread([this](SPxCheckpointData ckpt)
+      {
+         if(ckpt.writeFile(filename))
+            ++nWritten;
+
+         busy = false;
+      }, std::move(data));
+   }
+
+   /// waits until the last checkpoint has been written
+   void wait()
+   {
+      if(worker.joinable())
+         worker.join();
+   }
+
+private:
+
+   std::string filename;                               ///< name of the checkpoint file
+   int iterInterval;                                   ///< iterations between two checkpoints, 0 if unused
+   double timeInterval;                                ///< seconds between two checkpoints, 0 if unused
+   long long lastIteration;                            ///< iteration of the last checkpoint
+   std::chrono::steady_clock::time_point lastTime;     ///< time of the last checkpoint
+   std::thread worker;                                 ///< thread writing the last checkpoint
+   std::atomic<bool> busy;                             ///< is the last checkpoint still being written?
+   std::atomic<int> nWritten;                          ///< number of checkpoints written
+};
+
+} // namespace soplex
+#endif // _SPXCHECKPOINT_H_
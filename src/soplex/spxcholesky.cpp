@@ -0,0 +1,919 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <atomic>
+#include <assert.h>
+
+#include "soplex/spxcholesky.h"
+#include "soplex/spxthreads.h"
+
+namespace soplex
+{
+
+SPxCholesky::SPxCholesky()
+   : m_dim(0)
+   , m_nnz(0)
+   , m_pivtol(0.0)
+{
+   m_snFirst.assign(1, 0);
+}
+
+/* The minimum degree ordering works on the quotient graph: an eliminated node becomes an element, whose variables form
+ * a clique, instead of adding fill edges explicitly.  The degree of a variable is approximated from above by the sizes
+ * of its adjacent elements outside the element just formed, as in the approximate minimum degree ordering.  Elements
+ * contained in the new element are absorbed, and so are edges between variables of the new element.  Nodes of very
+ * high degree would make every element large; they are removed from the graph and ordered last.
+ */
+void SPxCholesky::orderMinDegree(std::vector<std::vector<int> >& adj)
+{
+   const int n = m_dim;
+   const int denseLimit = MAXIMUM(16, int(10.0 * std::sqrt(Real(n))));
+
+   // 0 - variable, 1 - element, 2 - absorbed element, 3 - dense variable
+   std::vector<char> status(n, 0);
+   std::vector<std::vector<int> > elemAdj(n);
+   std::vector<std::vector<int> > elemVars(n);
+   std::vector<int> dense;
+   std::vector<int> degree(n, 0);
+   std::vector<int> head(n + 1, -1);
+   std::vector<int> next(n, -1);
+   std::vector<int> prev(n, -1);
+   std::vector<int> mark(n, 0);
+   std::vector<int> wmark(n, 0);
+   std::vector<int> w(n, 0);
+   std::vector<int> lp;
+   int stamp = 0;
+
+   m_perm.clear();
+   m_perm.reserve(n);
+
+   for(int i = 0; i < n; ++i)
+   {
+      if(int(adj[i].size()) > denseLimit)
+      {
+         status[i] = 3;
+         dense.push_back(i);
+      }
+   }
+
+   auto insert = [&](int i, int d)
+   {
+      degree[i] = d;
+      prev[i] = -1;
+      next[i] = head[d];
+
+      if(head[d] >= 0)
+         prev[head[d]] = i;
+
+      head[d] = i;
+   };
+
+   auto remove = [&](int i)
+   {
+      if(prev[i] >= 0)
+         next[prev[i]] = next[i];
+      else
+         head[degree[i]] = next[i];
+
+      if(next[i] >= 0)
+         prev[next[i]] = prev[i];
+   };
+
+   for(int i = 0; i < n; ++i)
+   {
+      if(status[i] != 0)
+         continue;
+
+      int d = 0;
+
+      for(int v : adj[i])
+         d += (status[v] == 0) ? 1 : 0;
+
+      insert(i, d);
+   }
+
+   int nremaining = n - int(dense.size());
+   int mindeg = 0;
+
+   while(nremaining > 0)
+   {
+      while(head[mindeg] < 0)
+         ++mindeg;
+
+      const int p = head[mindeg];
+      remove(p);
+
+      // collect the variables of the new element p
+      ++stamp;
+      mark[p] = stamp;
+      lp.clear();
+
+      for(int v : adj[p])
+      {
+         if(status[v] == 0 && mark[v] != stamp)
+         {
+            mark[v] = stamp;
+            lp.push_back(v);
+         }
+      }
+
+      for(int e : elemAdj[p])
+      {
+         if(status[e] != 1)
+            continue;
+
+         for(int v : elemVars[e])
+         {
+            if(status[v] == 0 && mark[v] != stamp)
+            {
+               mark[v] = stamp;
+               lp.push_back(v);
+            }
+         }
+
+         status[e] = 2;
+         std::vector<int>().swap(elemVars[e]);
+      }
+
+      status[p] = 1;
+      std::vector<int>().swap(adj[p]);
+      std::vector<int>().swap(elemAdj[p]);
+      m_perm.push_back(p);
+      --nremaining;
+
+      // compute the number of variables of each adjacent element outside the new element
+      for(int i : lp)
+      {
+         for(int e : elemAdj[i])
+         {
+            if(status[e] != 1)
+               continue;
+
+            if(wmark[e] != stamp)
+            {
+               std::vector<int>& vars = elemVars[e];
+               int k = 0;
+
+               for(int v : vars)
+               {
+                  if(status[v] == 0)
+                     vars[k++] = v;
+               }
+
+               vars.resize(k);
+               wmark[e] = stamp;
+               w[e] = k;
+            }
+
+            --w[e];
+         }
+      }
+
+      // update the adjacency and the approximate degree of the variables of the new element
+      for(int i : lp)
+      {
+         remove(i);
+
+         int k = 0;
+         int d = int(lp.size()) - 1;
+         std::vector<int>& elems = elemAdj[i];
+
+         for(int e : elems)
+         {
+            if(status[e] != 1)
+               continue;
+
+            // elements covered by the new element are absorbed
+            if(w[e] <= 0)
+            {
+               status[e] = 2;
+               std::vector<int>().swap(elemVars[e]);
+               continue;
+            }
+
+            elems[k++] = e;
+            d += w[e];
+         }
+
+         elems.resize(k);
+         elems.push_back(p);
+
+         k = 0;
+         std::vector<int>& vars = adj[i];
+
+         for(int v : vars)
+         {
+            if(status[v] == 0 && mark[v] != stamp)
+               vars[k++] = v;
+         }
+
+         vars.resize(k);
+         d += k;
+         d = MINIMUM(d, nremaining - 1);
+
+         insert(i, d);
+         mindeg = MINIMUM(mindeg, d);
+      }
+
+      elemVars[p] = lp;
+   }
+
+   std::sort(dense.begin(), dense.end(), [&](int a, int b)
+   {
+      return adj[a].size() < adj[b].size() || (adj[a].size() == adj[b].size() && a < b);
+   });
+
+   m_perm.insert(m_perm.end(), dense.begin(), dense.end());
+   assert(int(m_perm.size()) == n);
+}
+
+
+
+void SPxCholesky::analyze(int dim, const int* colbeg, const int* rowidx)
+{
+   const int n = dim;
+
+   m_dim = dim;
+
+   // symmetric adjacency of the matrix without the diagonal
+   std::vector<std::vector<int> > adj(n);
+
+   for(int j = 0; j < n; ++j)
+   {
+      for(int p = colbeg[j]; p < colbeg[j + 1]; ++p)
+      {
+         const int i = rowidx[p];
+         assert(i >= j);
+         assert(i < n);
+
+         if(i != j)
+         {
+            adj[i].push_back(j);
+            adj[j].push_back(i);
+         }
+      }
+   }
+
+   for(int i = 0; i < n; ++i)
+   {
+      std::sort(adj[i].begin(), adj[i].end());
+      adj[i].erase(std::unique(adj[i].begin(), adj[i].end()), adj[i].end());
+   }
+
+   orderMinDegree(adj);
+   std::vector<std::vector<int> >().swap(adj);
+
+   std::vector<int> iperm(n);
+
+   for(int k = 0; k < n; ++k)
+      iperm[m_perm[k]] = k;
+
+   // row structures of the strict lower triangle of the permuted matrix, i.e., the columns c < r of each row r
+   std::vector<std::vector<int> > lowerRow(n);
+
+   for(int j = 0; j < n; ++j)
+   {
+      for(int p = colbeg[j]; p < colbeg[j + 1]; ++p)
+      {
+         const int pi = iperm[rowidx[p]];
+         const int pj = iperm[j];
+
+         if(pi != pj)
+            lowerRow[MAXIMUM(pi, pj)].push_back(MINIMUM(pi, pj));
+      }
+   }
+
+   // elimination tree with path compression
+   std::vector<int> parent(n, -1);
+   std::vector<int> ancestor(n, -1);
+
+   for(int k = 0; k < n; ++k)
+   {
+      for(int i : lowerRow[k])
+      {
+         while(i >= 0 && i < k)
+         {
+            const int inext = ancestor[i];
+            ancestor[i] = k;
+
+            if(inext < 0)
+               parent[i] = k;
+
+            i = inext;
+         }
+      }
+   }
+
+   // postorder of the elimination tree, such that every subtree is numbered consecutively
+   std::vector<int> childHead(n, -1);
+   std::vector<int> childNext(n, -1);
+
+   for(int j = n - 1; j >= 0; --j)
+   {
+      if(parent[j] >= 0)
+      {
+         childNext[j] = childHead[parent[j]];
+         childHead[parent[j]] = j;
+      }
+   }
+
+   std::vector<int> post;
+   std::vector<int> stack;
+   post.reserve(n);
+
+   for(int root = 0; root < n; ++root)
+   {
+      if(parent[root] >= 0)
+         continue;
+
+      stack.push_back(root);
+
+      while(!stack.empty())
+      {
+         const int j = stack.back();
+
+         if(childHead[j] >= 0)
+         {
+            const int c = childHead[j];
+            childHead[j] = childNext[c];
+            stack.push_back(c);
+         }
+         else
+         {
+            stack.pop_back();
+            post.push_back(j);
+         }
+      }
+   }
+
+   assert(int(post.size()) == n);
+
+   std::vector<int> ipost(n);
+
+   for(int k = 0; k < n; ++k)
+      ipost[post[k]] = k;
+
+   std::vector<int> perm(n);
+   std::vector<int> newParent(n);
+
+   for(int k = 0; k < n; ++k)
+   {
+      perm[k] = m_perm[post[k]];
+      newParent[k] = parent[post[k]] >= 0 ? ipost[parent[post[k]]] : -1;
+   }
+
+   m_perm.swap(perm);
+   parent.swap(newParent);
+
+   for(int k = 0; k < n; ++k)
+      iperm[m_perm[k]] = k;
+
+   // strict lower triangle of the permuted matrix by columns
+   std::vector<std::vector<int> > lowerCol(n);
+
+   for(int k = 0; k < n; ++k)
+   {
+      for(int c : lowerRow[k])
+         lowerCol[ipost[c]].push_back(ipost[k]);
+   }
+
+   std::vector<std::vector<int> >().swap(lowerRow);
+
+   std::vector<int> nchildren(n, 0);
+   childHead.assign(n, -1);
+   childNext.assign(n, -1);
+
+   for(int j = n - 1; j >= 0; --j)
+   {
+      if(parent[j] >= 0)
+      {
+         ++nchildren[parent[j]];
+         childNext[j] = childHead[parent[j]];
+         childHead[parent[j]] = j;
+      }
+   }
+
+   // structure of L column by column; the structure of every column is a suffix of the structure of the first column
+   // of its supernode, hence only the supernodes are stored
+   std::vector<int> mark(n, -1);
+   std::vector<int> count(n, 0);
+   std::vector<int> list;
+
+   m_snFirst.clear();
+   m_snOf.assign(n, -1);
+   m_rowBeg.assign(1, 0);
+   m_rowIdx.clear();
+
+   for(int j = 0; j < n; ++j)
+   {
+      list.clear();
+      list.push_back(j);
+      mark[j] = j;
+
+      for(int r : lowerCol[j])
+      {
+         if(mark[r] != j)
+         {
+            mark[r] = j;
+            list.push_back(r);
+         }
+      }
+
+      for(int c = childHead[j]; c >= 0; c = childNext[c])
+      {
+         const int s = m_snOf[c];
+         const int pos = m_rowBeg[s] + (c - m_snFirst[s]) + 1;
+
+         for(int p = pos; p < m_rowBeg[s + 1]; ++p)
+         {
+            const int r = m_rowIdx[p];
+
+            if(mark[r] != j)
+            {
+               mark[r] = j;
+               list.push_back(r);
+            }
+         }
+      }
+
+      count[j] = int(list.size());
+
+      // fundamental supernodes: j continues the supernode of its only child j - 1 if it has the same structure
+      if(j > 0 && parent[j - 1] == j && nchildren[j] == 1 && count[j] == count[j - 1] - 1)
+      {
+         m_snOf[j] = m_snOf[j - 1];
+         continue;
+      }
+
+      std::sort(list.begin(), list.end());
+      m_snOf[j] = int(m_snFirst.size());
+      m_snFirst.push_back(j);
+      m_rowIdx.insert(m_rowIdx.end(), list.begin(), list.end());
+      m_rowBeg.push_back(int(m_rowIdx.size()));
+   }
+
+   const int nsn = int(m_snFirst.size());
+   m_snFirst.push_back(n);
+
+   std::vector<std::vector<int> >().swap(lowerCol);
+
+   // supernodal elimination tree, storage and estimated work
+   m_snParent.assign(nsn, -1);
+   m_snFirstDesc.resize(nsn);
+   m_valBeg.assign(nsn + 1, 0);
+   m_work.assign(nsn, 0.0);
+   m_nnz = 0;
+
+   for(int s = 0; s < nsn; ++s)
+   {
+      const int ncols = m_snFirst[s + 1] - m_snFirst[s];
+      const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+
+      m_snFirstDesc[s] = s;
+      m_valBeg[s + 1] = m_valBeg[s] + (long long)(ld) * ncols;
+      m_nnz += (long long)(ld) * ncols - (long long)(ncols) * (ncols - 1) / 2;
+      m_work[s] += Real(ncols) * Real(ld) * Real(ld);
+
+      if(ld > ncols)
+         m_snParent[s] = m_snOf[m_rowIdx[m_rowBeg[s] + ncols]];
+   }
+
+   for(int s = 0; s < nsn; ++s)
+   {
+      const int p = m_snParent[s];
+
+      if(p >= 0)
+      {
+         assert(p > s);
+         m_snFirstDesc[p] = MINIMUM(m_snFirstDesc[p], m_snFirstDesc[s]);
+         m_work[p] += m_work[s];
+      }
+   }
+
+   // supernodes updating each supernode and the position of the first updated row
+   std::vector<int> nupd(nsn + 1, 0);
+
+   for(int k = 0; k < nsn; ++k)
+   {
+      int last = -1;
+
+      for(int p = m_rowBeg[k] + m_snFirst[k + 1] - m_snFirst[k]; p < m_rowBeg[k + 1]; ++p)
+      {
+         const int s = m_snOf[m_rowIdx[p]];
+
+         if(s != last)
+         {
+            ++nupd[s];
+            last = s;
+         }
+      }
+   }
+
+   m_updBeg.assign(nsn + 1, 0);
+
+   for(int s = 0; s < nsn; ++s)
+      m_updBeg[s + 1] = m_updBeg[s] + nupd[s];
+
+   m_updSn.resize(m_updBeg[nsn]);
+   m_updPos.resize(m_updBeg[nsn]);
+
+   std::vector<int> fill(m_updBeg.begin(), m_updBeg.end() - 1);
+
+   for(int k = 0; k < nsn; ++k)
+   {
+      int last = -1;
+
+      for(int p = m_rowBeg[k] + m_snFirst[k + 1] - m_snFirst[k]; p < m_rowBeg[k + 1]; ++p)
+      {
+         const int s = m_snOf[m_rowIdx[p]];
+
+         if(s != last)
+         {
+            m_updSn[fill[s]] = k;
+            m_updPos[fill[s]] = p - m_rowBeg[k];
+            ++fill[s];
+            last = s;
+         }
+      }
+   }
+
+   // position of every entry of the pattern in the supernodal storage
+   m_target.resize(colbeg[n]);
+
+   for(int j = 0; j < n; ++j)
+   {
+      for(int p = colbeg[j]; p < colbeg[j + 1]; ++p)
+      {
+         const int pi = iperm[rowidx[p]];
+         const int pj = iperm[j];
+         const int r = MAXIMUM(pi, pj);
+         const int c = MINIMUM(pi, pj);
+         const int s = m_snOf[c];
+         const int* rows = &m_rowIdx[m_rowBeg[s]];
+         const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+         const int pos = int(std::lower_bound(rows, rows + ld, r) - rows);
+
+         assert(pos < ld && rows[pos] == r);
+         m_target[p] = m_valBeg[s] + (long long)(c - m_snFirst[s]) * ld + pos;
+      }
+   }
+
+   std::vector<Real>().swap(m_val);
+}
+
+
+
+void SPxCholesky::updateSupernode(int s, int first, int last, const int* relpos)
+{
+   const int f = m_snFirst[s];
+   const int ncols = m_snFirst[s + 1] - f;
+   const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+   const int* rows = &m_rowIdx[m_rowBeg[s]];
+   Real* ls = &m_val[m_valBeg[s]];
+
+   assert(first < last);
+   assert(last <= ld);
+
+   const int rowlo = rows[first];
+   const int rowhi = rows[last - 1];
+
+   for(int u = m_updBeg[s]; u < m_updBeg[s + 1]; ++u)
+   {
+      const int k = m_updSn[u];
+      const int p1 = m_updPos[u];
+      const int nk = m_snFirst[k + 1] - m_snFirst[k];
+      const int ldk = m_rowBeg[k + 1] - m_rowBeg[k];
+      const int* rowsk = &m_rowIdx[m_rowBeg[k]];
+      const Real* lk = &m_val[m_valBeg[k]];
+
+      // rows of k within the columns of s
+      int p2 = p1;
+
+      while(p2 < ldk && rowsk[p2] < f + ncols)
+         ++p2;
+
+      // rows of k within the updated rows of s
+      const int ia = int(std::lower_bound(rowsk + p1, rowsk + ldk, rowlo) - rowsk);
+      const int ib = int(std::upper_bound(rowsk + ia, rowsk + ldk, rowhi) - rowsk);
+
+      if(ia >= ib)
+         continue;
+
+      for(int t = 0; t < nk; ++t)
+      {
+         const Real* colk = lk + (long long)(t) * ldk;
+
+         for(int q = p1; q < p2; ++q)
+         {
+            const Real lqt = colk[q];
+
+            if(lqt == 0.0)
+               continue;
+
+            Real* dst = ls + (long long)(rowsk[q] - f) * ld;
+
+            for(int i = MAXIMUM(q, ia); i < ib; ++i)
+               dst[relpos[rowsk[i]]] -= colk[i] * lqt;
+         }
+      }
+   }
+}
+
+
+
+int SPxCholesky::factorizeDiagonal(int s)
+{
+   const int ncols = m_snFirst[s + 1] - m_snFirst[s];
+   const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+   Real* ls = &m_val[m_valBeg[s]];
+   int ndropped = 0;
+
+   for(int c = 0; c < ncols; ++c)
+   {
+      Real* colc = ls + (long long)(c) * ld;
+
+      for(int t = 0; t < c; ++t)
+      {
+         const Real* colt = ls + (long long)(t) * ld;
+         const Real lct = colt[c];
+
+         if(lct == 0.0)
+            continue;
+
+         for(int i = c; i < ncols; ++i)
+            colc[i] -= colt[i] * lct;
+      }
+
+      if(!(colc[c] > m_pivtol))
+      {
+         colc[c] = SOPLEX_CHOLESKY_HUGE;
+         ++ndropped;
+      }
+      else
+         colc[c] = std::sqrt(colc[c]);
+
+      for(int i = c + 1; i < ncols; ++i)
+         colc[i] /= colc[c];
+   }
+
+   return ndropped;
+}
+
+
+
+void SPxCholesky::solveOffDiagonal(int s, int first, int last)
+{
+   const int ncols = m_snFirst[s + 1] - m_snFirst[s];
+   const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+   Real* ls = &m_val[m_valBeg[s]];
+
+   assert(first >= ncols);
+
+   for(int c = 0; c < ncols; ++c)
+   {
+      Real* colc = ls + (long long)(c) * ld;
+
+      for(int t = 0; t < c; ++t)
+      {
+         const Real* colt = ls + (long long)(t) * ld;
+         const Real lct = colt[c];
+
+         if(lct == 0.0)
+            continue;
+
+         for(int i = first; i < last; ++i)
+            colc[i] -= colt[i] * lct;
+      }
+
+      const Real d = colc[c];
+
+      for(int i = first; i < last; ++i)
+         colc[i] /= d;
+   }
+}
+
+
+
+int SPxCholesky::factorizeSupernode(int s, int* relpos)
+{
+   const int ncols = m_snFirst[s + 1] - m_snFirst[s];
+   const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+   const int* rows = &m_rowIdx[m_rowBeg[s]];
+
+   for(int i = 0; i < ld; ++i)
+      relpos[rows[i]] = i;
+
+   updateSupernode(s, 0, ld, relpos);
+
+   const int ndropped = factorizeDiagonal(s);
+
+   if(ld > ncols)
+      solveOffDiagonal(s, ncols, ld);
+
+   return ndropped;
+}
+
+
+
+/* Supernodes in disjoint subtrees of the supernodal elimination tree do not depend on each other.  The tree is split
+ * top-down, always at the subtree with the largest estimated work, until there are enough subtrees of moderate size to
+ * keep all threads busy.  These subtrees are factorized in parallel, each in postorder, and the supernodes above them
+ * are factorized afterwards in postorder with their rows distributed among the threads.
+ */
+int SPxCholesky::factorize(const Real* values, int nthreads)
+{
+   const int nsn = numSupernodes();
+
+   m_val.assign(m_valBeg[nsn], 0.0);
+
+   for(size_t p = 0; p < m_target.size(); ++p)
+      m_val[m_target[p]] += values[p];
+
+   Real maxdiag = 0.0;
+
+   for(int s = 0; s < nsn; ++s)
+   {
+      const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+
+      for(int c = 0; c < m_snFirst[s + 1] - m_snFirst[s]; ++c)
+         maxdiag = MAXIMUM(maxdiag, m_val[m_valBeg[s] + (long long)(c) * ld + c]);
+   }
+
+   m_pivtol = SOPLEX_CHOLESKY_PIVTOL * maxdiag;
+
+   std::vector<int> relpos(m_dim);
+
+   if(nthreads <= 1 || nsn <= 1)
+   {
+      int ndropped = 0;
+
+      for(int s = 0; s < nsn; ++s)
+         ndropped += factorizeSupernode(s, relpos.data());
+
+      return ndropped;
+   }
+
+   std::vector<std::vector<int> > children(nsn);
+   std::vector<int> subtrees;
+   std::vector<int> top;
+   Real total = 0.0;
+
+   for(int s = 0; s < nsn; ++s)
+   {
+      if(m_snParent[s] >= 0)
+         children[m_snParent[s]].push_back(s);
+      else
+      {
+         subtrees.push_back(s);
+         total += m_work[s];
+      }
+   }
+
+   while(int(subtrees.size()) < 16 * nthreads)
+   {
+      int largest = 0;
+
+      for(int b = 1; b < int(subtrees.size()); ++b)
+      {
+         if(m_work[subtrees[b]] > m_work[subtrees[largest]])
+            largest = b;
+      }
+
+      const int s = subtrees[largest];
+
+      if(children[s].empty() || m_work[s] <= total / (4 * nthreads))
+         break;
+
+      top.push_back(s);
+      subtrees[largest] = subtrees.back();
+      subtrees.pop_back();
+      subtrees.insert(subtrees.end(), children[s].begin(), children[s].end());
+   }
+
+   std::atomic<int> ndropped(0);
+
+   spxParallelFor(nthreads, int(subtrees.size()), [&](int b)
+   {
+      std::vector<int> subtreeRelpos(m_dim);
+      const int root = subtrees[b];
+      int dropped = 0;
+
+      for(int s = m_snFirstDesc[root]; s <= root; ++s)
+         dropped += factorizeSupernode(s, subtreeRelpos.data());
+
+      ndropped += dropped;
+   });
+
+   std::sort(top.begin(), top.end());
+
+   for(int s : top)
+   {
+      const int ncols = m_snFirst[s + 1] - m_snFirst[s];
+      const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+      const int* rows = &m_rowIdx[m_rowBeg[s]];
+      const int blocksize = MAXIMUM(64, (ld + 4 * nthreads - 1) / (4 * nthreads));
+
+      for(int i = 0; i < ld; ++i)
+         relpos[rows[i]] = i;
+
+      spxParallelForRange(nthreads, ld, [&](int first, int last)
+      {
+         updateSupernode(s, first, last, relpos.data());
+      }, blocksize);
+
+      ndropped += factorizeDiagonal(s);
+
+      if(ld > ncols)
+      {
+         spxParallelForRange(nthreads, ld - ncols, [&](int first, int last)
+         {
+            solveOffDiagonal(s, ncols + first, ncols + last);
+         }, blocksize);
+      }
+   }
+
+   return ndropped;
+}
+
+
+
+void SPxCholesky::solve(Real* rhs) const
+{
+   const int nsn = numSupernodes();
+   std::vector<Real> y(m_dim);
+
+   for(int k = 0; k < m_dim; ++k)
+      y[k] = rhs[m_perm[k]];
+
+   // forward substitution with L
+   for(int s = 0; s < nsn; ++s)
+   {
+      const int f = m_snFirst[s];
+      const int ncols = m_snFirst[s + 1] - f;
+      const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+      const int* rows = &m_rowIdx[m_rowBeg[s]];
+      const Real* ls = &m_val[m_valBeg[s]];
+
+      for(int c = 0; c < ncols; ++c)
+      {
+         const Real* colc = ls + (long long)(c) * ld;
+         const Real yj = y[f + c] / colc[c];
+
+         y[f + c] = yj;
+
+         if(yj == 0.0)
+            continue;
+
+         for(int i = c + 1; i < ld; ++i)
+            y[rows[i]] -= colc[i] * yj;
+      }
+   }
+
+   // backward substitution with L^T
+   for(int s = nsn - 1; s >= 0; --s)
+   {
+      const int f = m_snFirst[s];
+      const int ncols = m_snFirst[s + 1] - f;
+      const int ld = m_rowBeg[s + 1] - m_rowBeg[s];
+      const int* rows = &m_rowIdx[m_rowBeg[s]];
+      const Real* ls = &m_val[m_valBeg[s]];
+
+      for(int c = ncols - 1; c >= 0; --c)
+      {
+         const Real* colc = ls + (long long)(c) * ld;
+         Real v = y[f + c];
+
+         for(int i = c + 1; i < ld; ++i)
+            v -= colc[i] * y[rows[i]];
+
+         y[f + c] = v / colc[c];
+      }
+   }
+
+   for(int k = 0; k < m_dim; ++k)
+      rhs[m_perm[k]] = y[k];
+}
+
+} // namespace soplex
@@ -0,0 +1,160 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file  spxcholesky.h
+ * @brief Sparse supernodal Cholesky factorization.
+ */
+#ifndef _SPXCHOLESKY_H_
+#define _SPXCHOLESKY_H_
+
+#include <vector>
+
+#include "soplex/spxdefines.h"
+
+namespace soplex
+{
+
+/// relative size below which a pivot of the Cholesky factorization is considered zero
+#define SOPLEX_CHOLESKY_PIVTOL   1e-30
+
+/// value by which zero pivots are replaced, such that the corresponding solution entries vanish
+#define SOPLEX_CHOLESKY_HUGE     1e64
+
+/**@class SPxCholesky
+   @ingroup Algo
+
+   @brief Sparse supernodal Cholesky factorization of a symmetric positive definite matrix.
+
+   The factorization is computed in two phases.  analyze() works on the pattern of the lower triangle only: it computes
+   a minimum degree ordering on the quotient graph of the matrix, the elimination tree in postorder, the structure of
+   the factor L and its fundamental supernodes, i.e., maximal sets of consecutive columns of L sharing the same
+   structure, which are stored as dense blocks.  factorize() then computes L for the values of a matrix with this
+   pattern in left-looking fashion: each supernode gathers the updates of all supernodes below it in the elimination
+   tree before its dense diagonal block is factorized.  Independent subtrees of the supernodal elimination tree are
+   factorized in parallel, and the large supernodes near the root, which depend on all of them, are processed with
+   their rows split among the threads.
+
+   Pivots that are not positive or tiny relative to the largest diagonal entry are replaced by a huge value instead of
+   aborting the factorization.  This is the usual treatment of the normal equations of interior point methods, which
+   become singular near the end of the solve; the corresponding solution entries are set to zero.
+*/
+class SPxCholesky
+{
+public:
+
+   //-------------------------------------
+   /**@name Construction */
+   ///@{
+   /// default constructor
+   SPxCholesky();
+   ///@}
+
+   //-------------------------------------
+   /**@name Factorization */
+   ///@{
+   /// computes the ordering and the supernodal structure of the factor
+   /** The matrix of dimension \p dim is given by the pattern of its lower triangle in compressed column format, i.e.,
+    *  the row indices \p rowidx[\p colbeg[j]], ..., \p rowidx[\p colbeg[j+1] - 1] of column j must be at least j.
+    *  The entries need not be sorted and the diagonal need not be present.
+    */
+   void analyze(int dim, const int* colbeg, const int* rowidx);
+
+   /// computes the factorization using at most \p nthreads threads; returns the number of replaced pivots
+   /** \p values are the entries of the lower triangle in the order of the pattern passed to analyze().
+    */
+   int factorize(const Real* values, int nthreads = 1);
+
+   /// solves L L^T x = \p rhs in place
+   void solve(Real* rhs) const;
+   ///@}
+
+   //-------------------------------------
+   /**@name Inquiry */
+   ///@{
+   /// dimension of the matrix
+   int dim() const
+   {
+      return m_dim;
+   }
+
+   /// number of nonzeros of the factor including the explicit zeros of the supernodes
+   long long numNonzeros() const
+   {
+      return m_nnz;
+   }
+
+   /// number of supernodes
+   int numSupernodes() const
+   {
+      return int(m_snFirst.size()) - 1;
+   }
+   ///@}
+
+private:
+
+   //-------------------------------------
+   /**@name Private helpers */
+   ///@{
+   /// computes a minimum degree ordering of the graph with adjacency lists \p adj
+   void orderMinDegree(std::vector<std::vector<int> >& adj);
+
+   /// subtracts the updates of all descendants from the rows at positions [\p first, \p last) of supernode \p s
+   void updateSupernode(int s, int first, int last, const int* relpos);
+
+   /// factorizes the diagonal block of supernode \p s; returns the number of replaced pivots
+   int factorizeDiagonal(int s);
+
+   /// solves the rows at positions [\p first, \p last) of supernode \p s with the factorized diagonal block
+   void solveOffDiagonal(int s, int first, int last);
+
+   /// factorizes supernode \p s sequentially using \p relpos as work space of size dim()
+   int factorizeSupernode(int s, int* relpos);
+   ///@}
+
+   //-------------------------------------
+   /**@name Data */
+   ///@{
+   int m_dim;                          ///< dimension of the matrix
+   long long m_nnz;                    ///< number of nonzeros of the factor
+   Real m_pivtol;                      ///< absolute tolerance for zero pivots of the current factorization
+   std::vector<int> m_perm;            ///< m_perm[k] is the original index of the k-th pivot
+   std::vector<int> m_snFirst;         ///< first column of each supernode, followed by dim()
+   std::vector<int> m_snOf;            ///< supernode of each column
+   std::vector<int> m_snParent;        ///< parent of each supernode in the elimination tree, -1 for roots
+   std::vector<int> m_snFirstDesc;     ///< first supernode of the subtree rooted at each supernode
+   std::vector<int> m_rowBeg;          ///< start of the row structure of each supernode in m_rowIdx
+   std::vector<int> m_rowIdx;          ///< sorted row indices of the supernodes, starting with their own columns
+   std::vector<long long> m_valBeg;    ///< start of the dense column-major block of each supernode in m_val
+   std::vector<Real> m_val;            ///< dense blocks of the supernodes
+   std::vector<int> m_updBeg;          ///< start of the updating supernodes of each supernode in m_updSn
+   std::vector<int> m_updSn;           ///< supernodes updating a supernode
+   std::vector<int> m_updPos;          ///< position of the first row of the updated supernode in the updating one
+   std::vector<long long> m_target;    ///< position in m_val of each entry of the analyzed pattern
+   std::vector<Real> m_work;           ///< estimated work of the subtree rooted at each supernode
+   ///@}
+};
+
+} // namespace soplex
+
+#endif // _SPXCHOLESKY_H_
@@ -1218,12 +1218,14 @@ bool SPxFastRT<R>::maxReEnter(R& sel,
                this->thesolver->theShift -= (*up)[nr];
                (*up)[nr] = x;
                this->thesolver->theShift += (*up)[nr];
+               this->thesolver->markShifted(*up, nr);
             }
             else
             {
                this->thesolver->theShift += (*low)[nr];
                (*low)[nr] = x;
                this->thesolver->theShift -= (*low)[nr];
+               this->thesolver->markShifted(*low, nr);
             }
          }
       }
@@ -1241,6 +1243,7 @@ bool SPxFastRT<R>::maxReEnter(R& sel,
             this->thesolver->theShift += (*low)[nr] - x;
 
          (*up)[nr] = (*low)[nr] = x;
+         this->thesolver->markShifted(*up, nr);
       }
    }
 
@@ -1325,12 +1328,14 @@ bool SPxFastRT<R>::minReEnter(
                this->thesolver->theShift -= (*up)[nr];
                (*up)[nr] = x;
                this->thesolver->theShift += (*up)[nr];
+               this->thesolver->markShifted(*up, nr);
             }
             else
             {
                this->thesolver->theShift += (*low)[nr];
                (*low)[nr] = x;
                this->thesolver->theShift -= (*low)[nr];
+               this->thesolver->markShifted(*low, nr);
             }
          }
       }
@@ -1348,6 +1353,7 @@ bool SPxFastRT<R>::minReEnter(
             this->thesolver->theShift += (*low)[nr] - x;
 
          (*up)[nr] = (*low)[nr] = x;
+         this->thesolver->markShifted(*up, nr);
       }
    }
 
@@ -38,6 +38,8 @@
 #include <iostream>
 #include <iomanip>
 #include <typeinfo>
+#include <unordered_map>
+#include <vector>
 
 #include "soplex/spxdefines.h"
 #include "soplex/basevectors.h"
@@ -52,8 +54,11 @@
 #include "soplex/didxset.h"
 #include "soplex/spxfileio.h"
 #include "soplex/spxscaler.h"
+#include "soplex/spxthreads.h"
 #include "soplex/rational.h"
 
+#define ELEMENTINDEX_MINSIZE  256   /**< minimum size of a row or column whose nonzero positions are kept in an index */
+
 namespace soplex
 {
 // Declarations to fix errors of the form "SPxMainSM is not a type"
@@ -140,6 +145,13 @@ private:
    bool _isScaled;                   ///< true, if scaling has been performed
    SPxScaler<R>*
    lp_scaler;             ///< points to the scaler if the lp has been scaled, to nullptr otherwise
+   int _threads;                     ///< number of threads used for computing activities
+
+   /// positions of the nonzeros of long rows or columns, indexed by vector number and nonzero index
+   typedef std::unordered_map<int, std::unordered_map<int, int> > ElementIndex;
+
+   ElementIndex _rowElementIndex;    ///< positions of the nonzeros of long rows, see elementPos()
+   ElementIndex _colElementIndex;    ///< positions of the nonzeros of long columns, see elementPos()
 
    ///@}
 
@@ -155,6 +167,21 @@ public:
       spxout = &newOutstream;
    }
 
+   /// sets the number of threads used for computing activities
+   void setThreads(int threads)
+   {
+      assert(threads >= 1);
+      _threads = threads;
+   }
+
+   /// sets the maximum number of nonzeros moved by one incremental compaction step of the row- and column-wise
+   /// nonzero memory; 0 compacts the nonzero memory at once when it is exhausted
+   void setMemPackSlice(int slice)
+   {
+      LPRowSetBase<R>::setMemPackSlice(slice);
+      LPColSetBase<R>::setMemPackSlice(slice);
+   }
+
    // ------------------------------------------------------------------------------------------------------------------
 
    /// unscales the lp and clears basis
@@ -169,6 +196,12 @@ public:
       return _isScaled;
    }
 
+   /// Returns the number of threads used for computing activities
+   int threads() const
+   {
+      return _threads;
+   }
+
    /// set whether the LP is scaled or not
    void setScalingInfo(bool scaled)
    {
@@ -199,6 +232,22 @@ public:
       return n;
    }
 
+   /// Returns number of bytes allocated for the nonzeros of the row- and column-wise constraint matrix.
+   size_t nzoMemory() const
+   {
+      return (size_t(LPRowSetBase<R>::memMax()) + size_t(LPColSetBase<R>::memMax())) * sizeof(Nonzero<R>);
+   }
+
+   /// Returns the accumulated statistics of the compaction of the row- and column-wise nonzero memory.
+   SVSetMemStats nzoMemStats() const
+   {
+      SVSetMemStats stats = LPRowSetBase<R>::memStats();
+
+      stats += LPColSetBase<R>::memStats();
+
+      return stats;
+   }
+
    /// Absolute smallest non-zero element in (possibly scaled) LP.
    virtual R minAbsNzo(bool unscaled = true) const;
 
@@ -1156,6 +1205,15 @@ public:
       removeCols(perm);
    }
 
+   /// Packs the nonzeros of the row- and column-wise constraint matrix and releases all unused nonzero memory.
+   void packNzoMemory()
+   {
+      LPRowSetBase<R>::memPack();
+      LPRowSetBase<R>::memRemax(LPRowSetBase<R>::memSize());
+      LPColSetBase<R>::memPack();
+      LPColSetBase<R>::memRemax(LPColSetBase<R>::memSize());
+   }
+
    /// clears the LP.
    virtual void clear()
    {
@@ -1168,6 +1226,8 @@ public:
       lp_scaler = nullptr;
       LPColSetBase<R>::scaleExp.clear();
       LPRowSetBase<R>::scaleExp.clear();
+      _rowElementIndex.clear();
+      _colElementIndex.clear();
    }
 
    ///@}
@@ -1829,8 +1889,10 @@ public:
       if(i < 0 || j < 0)
          return;
 
-      SVectorBase<R>& row = rowVector_w(i);
-      SVectorBase<R>& col = colVector_w(j);
+      int rowPos;
+      int colPos;
+
+      elementPos(i, j, rowPos, colPos);
 
       if(isNotZero(val))
       {
@@ -1845,23 +1907,59 @@ public:
          else
             newVal = val;
 
-         if(row.pos(j) >= 0 && col.pos(i) >= 0)
+         if(rowPos >= 0)
          {
-            row.value(row.pos(j)) = newVal;
-            col.value(col.pos(i)) = newVal;
+            rowVector_w(i).value(rowPos) = newVal;
+            colVector_w(j).value(colPos) = newVal;
          }
          else
          {
             LPRowSetBase<R>::add2(i, 1, &j, &newVal);
             LPColSetBase<R>::add2(j, 1, &i, &newVal);
+            addedElement(i, j);
          }
       }
-      else if(row.pos(j) >= 0 && col.pos(i) >= 0)
+      else if(rowPos >= 0)
+         removeElement(i, j, rowPos, colPos);
+
+      assert(isConsistent());
+   }
+
+   /// Changes the LP elements (\p rows[k], \p cols[k]) to \p vals[k] for k = 0, ..., \p n - 1 in one pass over each
+   /// affected row and column, where a later change of the same element overrides an earlier one. \p scale determines
+   /// whether the new data should be scaled
+   virtual void changeElements(int n, const int rows[], const int cols[], const R vals[], bool scale = false)
+   {
+      std::vector<int> changes;
+      std::vector<R> newVals(n);
+      std::vector<bool> isZero(n);
+
+      changes.reserve(n);
+
+      for(int k = 0; k < n; k++)
       {
-         row.remove(row.pos(j));
-         col.remove(col.pos(i));
+         if(rows[k] < 0 || cols[k] < 0)
+            continue;
+
+         assert(rows[k] < nRows());
+         assert(cols[k] < nCols());
+
+         changes.push_back(k);
+         isZero[k] = !isNotZero(vals[k]);
+
+         if(scale && !isZero[k])
+         {
+            assert(_isScaled);
+            assert(lp_scaler);
+            newVals[k] = lp_scaler->scaleElement(*this, rows[k], cols[k], vals[k]);
+         }
+         else
+            newVals[k] = vals[k];
       }
 
+      mergeElements(changes, rows, cols, newVals, isZero, true);
+      mergeElements(changes, cols, rows, newVals, isZero, false);
+
       assert(isConsistent());
    }
 
@@ -1872,27 +1970,27 @@ public:
       if(i < 0 || j < 0)
          return;
 
-      SVectorBase<R>& row = rowVector_w(i);
-      SVectorBase<R>& col = colVector_w(j);
+      int rowPos;
+      int colPos;
+
+      elementPos(i, j, rowPos, colPos);
 
       if(mpq_get_d(*val) != R(0))
       {
-         if(row.pos(j) >= 0 && col.pos(i) >= 0)
+         if(rowPos >= 0)
          {
-            row.value(row.pos(j)) = *val;
-            col.value(col.pos(i)) = *val;
+            rowVector_w(i).value(rowPos) = *val;
+            colVector_w(j).value(colPos) = *val;
          }
          else
          {
             LPRowSetBase<R>::add2(i, 1, &j, val);
             LPColSetBase<R>::add2(j, 1, &i, val);
+            addedElement(i, j);
          }
       }
-      else if(row.pos(j) >= 0 && col.pos(i) >= 0)
-      {
-         row.remove(row.pos(j));
-         col.remove(col.pos(i));
-      }
+      else if(rowPos >= 0)
+         removeElement(i, j, rowPos, colPos);
 
       assert(isConsistent());
    }
@@ -1986,11 +2084,22 @@ public:
          throw SPxInternalCodeException("XSPXLP04 Activity vector computing dual activity has wrong dimension");
       }
 
-      for(int r = 0; r < nRows(); r++)
+      // the activities are updated column by column, such that the columns can be distributed among the threads
+      spxParallelForRange(_threads, nCols(), [&](int first, int last)
       {
-         if(dual[r] != 0)
-            activity.multSub(dual[r], rowVector(r));
-      }
+         for(int c = first; c < last; c++)
+         {
+            const SVectorBase<R>& colVec = colVector(c);
+
+            for(int i = 0; i < colVec.size(); i++)
+            {
+               const R& y = dual[colVec.index(i)];
+
+               if(y != 0)
+                  activity[c] -= colVec.value(i) * y;
+            }
+         }
+      });
    }
 
    ///@}
@@ -2120,9 +2229,194 @@ protected:
       return static_cast<const LPColSetBase<R>*>(this);
    }
 
+   /// Returns the position of the nonzero with index \p idx in the \p n 'th vector \p vec of a row or column set.
+   /** The nonzero must be contained in \p vec.  For vectors of at least ELEMENTINDEX_MINSIZE nonzeros, the position is
+    *  looked up in \p index, which is rebuilt whenever it is found to be out of date, e.g., because the vector was
+    *  modified by other methods than changeElement().
+    */
+   static int indexedPos(const SVectorBase<R>& vec, int n, int idx, ElementIndex& index)
+   {
+      if(vec.size() < ELEMENTINDEX_MINSIZE)
+         return vec.pos(idx);
+
+      std::unordered_map<int, int>& vecIndex = index[n];
+      auto it = vecIndex.find(idx);
+
+      if(it != vecIndex.end() && it->second < vec.size() && vec.index(it->second) == idx)
+         return it->second;
+
+      vecIndex.clear();
+      vecIndex.reserve(vec.size());
+
+      for(int p = 0; p < vec.size(); ++p)
+         vecIndex[vec.index(p)] = p;
+
+      it = vecIndex.find(idx);
+
+      return (it != vecIndex.end()) ? it->second : -1;
+   }
+
+   /// Computes the positions of element (\p i, \p j) in row \p i and column \p j, or -1 if the element is zero.
+   /** Only the shorter of both vectors is searched linearly, since it contains the element if and only if the longer one
+    *  does; the position in the longer vector is looked up with indexedPos().
+    */
+   void elementPos(int i, int j, int& rowPos, int& colPos)
+   {
+      const SVectorBase<R>& row = rowVector(i);
+      const SVectorBase<R>& col = colVector(j);
+
+      if(row.size() <= col.size())
+      {
+         rowPos = row.pos(j);
+         colPos = (rowPos >= 0) ? indexedPos(col, j, i, _colElementIndex) : -1;
+      }
+      else
+      {
+         colPos = col.pos(i);
+         rowPos = (colPos >= 0) ? indexedPos(row, i, j, _rowElementIndex) : -1;
+      }
+
+      assert((rowPos >= 0) == (colPos >= 0));
+   }
+
+   /// Updates the position indices after element (\p i, \p j) has been appended to row \p i and column \p j.
+   void addedElement(int i, int j)
+   {
+      auto rowIt = _rowElementIndex.find(i);
+
+      if(rowIt != _rowElementIndex.end())
+         rowIt->second[j] = rowVector(i).size() - 1;
+
+      auto colIt = _colElementIndex.find(j);
+
+      if(colIt != _colElementIndex.end())
+         colIt->second[i] = colVector(j).size() - 1;
+   }
+
+   /// Removes element (\p i, \p j) at positions \p rowPos and \p colPos and updates the position indices.
+   void removeElement(int i, int j, int rowPos, int colPos)
+   {
+      SVectorBase<R>& row = rowVector_w(i);
+      SVectorBase<R>& col = colVector_w(j);
+
+      // SVectorBase::remove() moves the last nonzero to the removed position
+      int rowMoved = row.index(row.size() - 1);
+      int colMoved = col.index(col.size() - 1);
+
+      row.remove(rowPos);
+      col.remove(colPos);
+
+      auto rowIt = _rowElementIndex.find(i);
+
+      if(rowIt != _rowElementIndex.end())
+      {
+         rowIt->second.erase(j);
+
+         if(rowMoved != j)
+            rowIt->second[rowMoved] = rowPos;
+      }
+
+      auto colIt = _colElementIndex.find(j);
+
+      if(colIt != _colElementIndex.end())
+      {
+         colIt->second.erase(i);
+
+         if(colMoved != i)
+            colIt->second[colMoved] = colPos;
+      }
+   }
+
+   /// Applies the changes \p changes of changeElements() to the rows, if \p rowwise is true, or to the columns.
+   /** The changes are sorted by vector and every affected vector is processed in one pass, where \p vecs and \p idxs
+    *  give the vector and nonzero index of each change.
+    */
+   void mergeElements(const std::vector<int>& changes, const int vecs[], const int idxs[], const std::vector<R>& vals,
+                      const std::vector<bool>& isZero, bool rowwise)
+   {
+      const int nvecs = rowwise ? nRows() : nCols();
+      const int dim = rowwise ? nCols() : nRows();
+      ElementIndex& index = rowwise ? _rowElementIndex : _colElementIndex;
+
+      // sort the changes by vector, keeping their order within each vector
+      std::vector<int> start(nvecs + 1, 0);
+      std::vector<int> order(changes.size());
+
+      for(int k : changes)
+         start[vecs[k] + 1]++;
+
+      for(int v = 0; v < nvecs; ++v)
+         start[v + 1] += start[v];
+
+      std::vector<int> next(start.begin(), start.end() - 1);
+
+      for(int k : changes)
+         order[next[vecs[k]]++] = k;
+
+      std::vector<int> position(dim, -1);
+
+      for(int v = 0; v < nvecs; ++v)
+      {
+         if(start[v] == start[v + 1])
+            continue;
+
+         int nadd = 0;
+
+         for(int l = start[v]; l < start[v + 1]; ++l)
+         {
+            if(!isZero[order[l]])
+               ++nadd;
+         }
+
+         if(nadd > 0)
+         {
+            if(rowwise)
+               LPRowSetBase<R>::xtend(v, rowVector(v).size() + nadd);
+            else
+               LPColSetBase<R>::xtend(v, colVector(v).size() + nadd);
+         }
+
+         SVectorBase<R>& vec = rowwise ? rowVector_w(v) : colVector_w(v);
+
+         for(int p = 0; p < vec.size(); ++p)
+            position[vec.index(p)] = p;
+
+         for(int l = start[v]; l < start[v + 1]; ++l)
+         {
+            int k = order[l];
+            int idx = idxs[k];
+            int p = position[idx];
+
+            if(!isZero[k])
+            {
+               if(p >= 0)
+                  vec.value(p) = vals[k];
+               else
+               {
+                  position[idx] = vec.size();
+                  vec.add(idx, vals[k]);
+               }
+            }
+            else if(p >= 0)
+            {
+               position[vec.index(vec.size() - 1)] = p;
+               position[idx] = -1;
+               vec.remove(p);
+            }
+         }
+
+         for(int p = 0; p < vec.size(); ++p)
+            position[vec.index(p)] = -1;
+
+         index.erase(v);
+      }
+   }
+
    /// Internal helper method.
    virtual void doRemoveRow(int j)
    {
+      _rowElementIndex.clear();
+      _colElementIndex.clear();
 
       const SVectorBase<R>& vec = rowVector(j);
 
@@ -2161,6 +2455,8 @@ protected:
    /// Internal helper method.
    virtual void doRemoveRows(int perm[])
    {
+      _rowElementIndex.clear();
+      _colElementIndex.clear();
       int j = nCols();
 
       LPRowSetBase<R>::remove(perm);
@@ -2184,6 +2480,8 @@ protected:
    /// Internal helper method.
    virtual void doRemoveCol(int j)
    {
+      _rowElementIndex.clear();
+      _colElementIndex.clear();
 
       const SVectorBase<R>& vec = colVector(j);
       int i;
@@ -2225,6 +2523,8 @@ protected:
    /// Internal helper method.
    virtual void doRemoveCols(int perm[])
    {
+      _rowElementIndex.clear();
+      _colElementIndex.clear();
       int nrows = nRows();
 
       LPColSetBase<R>::remove(perm);
@@ -2807,6 +3107,7 @@ public:
 
    /// Default constructor.
    SPxLPBase<R>()
+      : _threads(1)
    {
       SPxLPBase<R>::clear(); // clear is virtual.
 
@@ -2825,6 +3126,7 @@ public:
       , offset(old.offset)
       , _isScaled(old._isScaled)
       , lp_scaler(old.lp_scaler)
+      , _threads(old._threads)
       , spxout(old.spxout)
    {
       assert(isConsistent());
@@ -2838,6 +3140,7 @@ public:
       , thesense(old.thesense == SPxLPBase<S>::MINIMIZE ? SPxLPBase<R>::MINIMIZE : SPxLPBase<R>::MAXIMIZE)
       , offset(old.offset)
       , _isScaled(old._isScaled)
+      , _threads(old._threads)
       , spxout(old.spxout)
    {
       lp_scaler = nullptr;
@@ -2855,6 +3158,7 @@ public:
          offset = old.offset;
          _isScaled = old._isScaled;
          lp_scaler = old.lp_scaler;
+         _threads = old._threads;
          spxout = old.spxout;
 
          assert(isConsistent());
@@ -2873,8 +3177,8 @@ public:
          // Refer to issue #161 in soplex gitlab
          assert(old.lp_scaler == nullptr);
 
-         LPRowSetBase<R>::operator=(old);
-         LPColSetBase<R>::operator=(old);
+         LPRowSetBase<R>::assign(old, old._threads);
+         LPColSetBase<R>::assign(old, old._threads);
          thesense = (old.thesense) == SPxLPBase<S>::MINIMIZE ? SPxLPBase<R>::MINIMIZE :
                     SPxLPBase<R>::MAXIMIZE;
          offset = R(old.offset);
@@ -2882,6 +3186,7 @@ public:
 
          // this may have un-intended consequences in the future
          lp_scaler = nullptr;
+         _threads = old._threads;
          spxout = old.spxout;
 
          assert(isConsistent());
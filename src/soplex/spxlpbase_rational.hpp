@@ -55,29 +55,24 @@ void SPxLPBase<Rational>::computePrimalActivity(const VectorBase<Rational>& prim
       throw SPxInternalCodeException("XSPXLP03 Activity vector computing row activity has wrong dimension");
    }
 
-   int c;
-
-   for(c = 0; c < nCols() && primal[c] == 0; c++)
-      ;
-
-   if(c >= nCols())
+   // the activities are computed row by row, such that the rows can be distributed among the threads
+   spxParallelForRange(_threads, nRows(), [&](int first, int last)
    {
-      activity.clear();
-      return;
-   }
+      for(int r = first; r < last; r++)
+      {
+         const SVectorBase<Rational>& rowVec = rowVector(r);
 
-   activity = colVector(c);
+         activity[r] = 0;
 
-   activity *= primal[c];
-   c++;
+         for(int i = 0; i < rowVec.size(); i++)
+         {
+            const Rational& x = primal[rowVec.index(i)];
 
-   for(; c < nCols(); c++)
-   {
-      if(primal[c] != 0)
-      {
-         activity.multAdd(primal[c], colVector(c));
+            if(x != 0)
+               activity[r] += rowVec.value(i) * x;
+         }
       }
-   }
+   });
 }
 
 template<> inline
@@ -94,29 +89,24 @@ void SPxLPBase<Rational>::computeDualActivity(const VectorBase<Rational>& dual,
       throw SPxInternalCodeException("XSPXLP04 Activity vector computing dual activity has wrong dimension");
    }
 
-   int r;
-
-   for(r = 0; r < nRows() && dual[r] == 0; r++)
-      ;
-
-   if(r >= nRows())
+   // the activities are computed column by column, such that the columns can be distributed among the threads
+   spxParallelForRange(_threads, nCols(), [&](int first, int last)
    {
-      activity.clear();
-      return;
-   }
+      for(int c = first; c < last; c++)
+      {
+         const SVectorBase<Rational>& colVec = colVector(c);
 
-   activity = rowVector(r);
+         activity[c] = 0;
 
-   activity *= dual[r];
-   r++;
+         for(int i = 0; i < colVec.size(); i++)
+         {
+            const Rational& y = dual[colVec.index(i)];
 
-   for(; r < nRows(); r++)
-   {
-      if(dual[r] != 0)
-      {
-         activity.multAdd(dual[r], rowVector(r));
+            if(y != 0)
+               activity[c] += colVec.value(i) * y;
+         }
       }
-   }
+   });
 }
 
 template<> inline
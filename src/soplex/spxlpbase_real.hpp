@@ -83,43 +83,23 @@ void SPxLPBase<R>::computePrimalActivity(const VectorBase<R>& primal, VectorBase
    if(activity.dim() != nRows())
       throw SPxInternalCodeException("XSPXLP03 Activity vector computing row activity has wrong dimension");
 
-   int c;
-
-   for(c = 0; c < nCols() && primal[c] == 0; c++)
-      ;
-
-   if(c >= nCols())
+   // every activity is computed as one dot product over its row, such that the result does not depend on the number
+   // of threads
+   spxParallelForRange(_threads, nRows(), [&](int first, int last)
    {
-      activity.clear();
-      return;
-   }
+      DSVectorBase<R> tmp;
 
-   DSVectorBase<R> tmp(nRows());
-
-   if(unscaled && _isScaled)
-   {
-      lp_scaler->getColUnscaled(*this, c, tmp);
-      activity = tmp;
-   }
-   else
-      activity = colVector(c);
-
-   activity *= primal[c];
-   c++;
-
-   for(; c < nCols(); c++)
-   {
-      if(primal[c] != 0)
+      for(int r = first; r < last; r++)
       {
          if(unscaled && _isScaled)
          {
-            lp_scaler->getColUnscaled(*this, c, tmp);
-            activity.multAdd(primal[c], tmp);
+            lp_scaler->getRowUnscaled(*this, r, tmp);
+            activity[r] = tmp * primal;
          }
          else
-            activity.multAdd(primal[c], colVector(c));
+            activity[r] = rowVector(r) * primal;
       }
-   }
+   });
 }
 
 template <class R> inline
@@ -132,43 +112,23 @@ void SPxLPBase<R>::computeDualActivity(const VectorBase<R>& dual, VectorBase<R>&
    if(activity.dim() != nCols())
       throw SPxInternalCodeException("XSPXLP04 Activity vector computing dual activity has wrong dimension");
 
-   int r;
-
-   for(r = 0; r < nRows() && dual[r] == 0; r++)
-      ;
-
-   if(r >= nRows())
+   // every activity is computed as one dot product over its column, such that the result does not depend on the
+   // number of threads
+   spxParallelForRange(_threads, nCols(), [&](int first, int last)
    {
-      activity.clear();
-      return;
-   }
+      DSVectorBase<R> tmp;
 
-   DSVectorBase<R> tmp(nCols());
-
-   if(unscaled && _isScaled)
-   {
-      lp_scaler->getRowUnscaled(*this, r, tmp);
-      activity = tmp;
-   }
-   else
-      activity = rowVector(r);
-
-   activity *= dual[r];
-   r++;
-
-   for(; r < nRows(); r++)
-   {
-      if(dual[r] != 0)
+      for(int c = first; c < last; c++)
       {
          if(unscaled && _isScaled)
          {
-            lp_scaler->getRowUnscaled(*this, r, tmp);
-            activity.multAdd(dual[r], tmp);
+            lp_scaler->getColUnscaled(*this, c, tmp);
+            activity[c] = tmp * dual;
          }
          else
-            activity.multAdd(dual[r], rowVector(r));
+            activity[c] = colVector(c) * dual;
       }
-   }
+   });
 }
 
 template <class R> inline
@@ -22,7 +22,10 @@
 /*                                                                           */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#include <mutex>
+
 #include "soplex/spxout.h"
+#include "soplex/spxoutsink.h"
 #include "soplex/exceptions.h"
 #include "soplex/spxalloc.h"
 
@@ -72,4 +75,192 @@ SPxOut::SPxOut(const SPxOut& rhs)
       m_streams[ i ] = rhs.m_streams[ i ];
 }
 
+void SPxOut::setSink(SPxOutAsyncSink& sink)
+{
+   for(int i = ERROR; i <= INFO3; ++i)
+      m_streams[ i ] = &sink.stream(Verbosity(i));
+
+   sink.m_owner = this;
+}
+
+//---------------------------------------------------
+
+/// names of the verbosity levels in structured records
+static const char* const verbosityName[] = {"ERROR", "WARNING", "DEBUG", "INFO1", "INFO2", "INFO3"};
+
+/// lock shared by all sinks, such that records of different sinks do not interleave
+static std::mutex& sinkWriteLock()
+{
+   static std::mutex lock;
+   return lock;
+}
+
+SPxOutAsyncSink::SPxOutAsyncSink(std::ostream& out, std::ostream& err, int capacity, bool structured,
+                                 const std::string& tag)
+   : m_out(out)
+   , m_err(err)
+   , m_structured(structured)
+   , m_tag(tag)
+   , m_start(std::chrono::steady_clock::now())
+   , m_ring(capacity > 0 ? capacity : 1)
+   , m_head(0)
+   , m_tail(0)
+   , m_stop(false)
+   , m_numWritten(0)
+   , m_numWaits(0)
+   , m_owner(0)
+{
+   for(int i = 0; i < 2; ++i)
+   {
+      m_bufs.push_back(new LineBuf(this));
+      m_streams.push_back(new std::ostream(m_bufs.back()));
+   }
+
+   m_thread = std::thread(&SPxOutAsyncSink::run, this);
+}
+
+SPxOutAsyncSink::~SPxOutAsyncSink()
+{
+   for(size_t i = 0; i < m_bufs.size(); ++i)
+      m_bufs[i]->finish();
+
+   m_stop.store(true, std::memory_order_release);
+   m_thread.join();
+
+   for(size_t i = 0; i < m_streams.size(); ++i)
+   {
+      delete m_streams[i];
+      delete m_bufs[i];
+   }
+}
+
+void SPxOutAsyncSink::flush()
+{
+   const size_t tail = m_tail.load(std::memory_order_relaxed);
+
+   while(m_head.load(std::memory_order_acquire) != tail)
+      std::this_thread::yield();
+
+   std::lock_guard<std::mutex> guard(sinkWriteLock());
+   m_out.flush();
+   m_err.flush();
+}
+
+void SPxOutAsyncSink::push(int level, std::string& text)
+{
+   const size_t tail = m_tail.load(std::memory_order_relaxed);
+
+   if(tail - m_head.load(std::memory_order_acquire) >= m_ring.size())
+   {
+      ++m_numWaits;
+
+      while(tail - m_head.load(std::memory_order_acquire) >= m_ring.size())
+         std::this_thread::yield();
+   }
+
+   // the slot is free, hence only this thread accesses it until the tail is advanced
+   Record& rec = m_ring[tail % m_ring.size()];
+   rec.level = level;
+   rec.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+   rec.text.swap(text);
+   text.clear();
+
+   m_tail.store(tail + 1, std::memory_order_release);
+}
+
+void SPxOutAsyncSink::write(const Record& rec)
+{
+   std::ostream& target = (rec.level <= SPxOut::WARNING) ? m_err : m_out;
+
+   if(m_structured)
+   {
+      char prefix[64];
+      spxSnprintf(prefix, sizeof(prefix), " %s %.3f] ", verbosityName[rec.level], rec.time);
+      std::string line = "[" + m_tag + (m_tag.empty() ? prefix + 1 : prefix) + rec.text;
+      target.write(line.data(), std::streamsize(line.size()));
+   }
+   else
+      target.write(rec.text.data(), std::streamsize(rec.text.size()));
+}
+
+void SPxOutAsyncSink::run()
+{
+   size_t head = 0;
+
+   while(true)
+   {
+      size_t tail = m_tail.load(std::memory_order_acquire);
+
+      if(head == tail)
+      {
+         if(m_stop.load(std::memory_order_acquire))
+         {
+            // records appended before the stop request are still written
+            if(m_tail.load(std::memory_order_acquire) == head)
+               break;
+
+            continue;
+         }
+
+         std::this_thread::sleep_for(std::chrono::microseconds(200));
+         continue;
+      }
+
+      // write all available records in one batch and flush the targets once
+      {
+         std::lock_guard<std::mutex> guard(sinkWriteLock());
+
+         for(; head != tail; ++head)
+         {
+            Record& rec = m_ring[head % m_ring.size()];
+            write(rec);
+            rec.text.clear();
+            m_head.store(head + 1, std::memory_order_release);
+            ++m_numWritten;
+         }
+
+         m_out.flush();
+         m_err.flush();
+      }
+   }
+}
+
+void SPxOutAsyncSink::LineBuf::finish()
+{
+   if(!m_line.empty())
+   {
+      m_line.push_back('\n');
+      m_sink->push(m_level, m_line);
+   }
+}
+
+SPxOutAsyncSink::LineBuf::int_type SPxOutAsyncSink::LineBuf::overflow(int_type c)
+{
+   if(traits_type::eq_int_type(c, traits_type::eof()))
+      return traits_type::not_eof(c);
+
+   append(traits_type::to_char_type(c));
+
+   return c;
+}
+
+std::streamsize SPxOutAsyncSink::LineBuf::xsputn(const char* s, std::streamsize n)
+{
+   for(std::streamsize i = 0; i < n; ++i)
+      append(s[i]);
+
+   return n;
+}
+
+void SPxOutAsyncSink::LineBuf::append(char c)
+{
+   if(m_line.empty())
+      m_level = (m_sink->m_owner != 0) ? int(m_sink->m_owner->getVerbosity()) : int(SPxOut::INFO1);
+
+   m_line.push_back(c);
+
+   if(c == '\n')
+      m_sink->push(m_level, m_line);
+}
+
 } // namespace soplex
@@ -41,6 +41,8 @@
 namespace soplex
 {
 
+class SPxOutAsyncSink;
+
 /**@class SPxOut
    @ingroup Elementary
 
@@ -161,6 +163,9 @@ public:
    {
       m_streams[ verbosity ] = &stream;
    }
+   /// Sets the streams of all verbosity levels to the streams of the asynchronous \p sink, which must outlive their
+   /// use.
+   void setSink(SPxOutAsyncSink& sink);
    /// Returns the stream for the specified verbosity level.
    inline std::ostream&
    getStream(const Verbosity& verbosity)
@@ -0,0 +1,165 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file  spxoutsink.h
+ * @brief Asynchronous, buffered log sink for SPxOut.
+ */
+#ifndef _SPXOUTSINK_H_
+#define _SPXOUTSINK_H_
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "soplex/spxout.h"
+
+namespace soplex
+{
+
+/**@class SPxOutAsyncSink
+   @ingroup Elementary
+
+   @brief Asynchronous log sink for SPxOut.
+
+   The sink provides an output stream for info and debug messages and an error stream for errors and warnings, which
+   SPxOut::setSink() installs as the streams of an SPxOut; like std::cout and std::cerr, all verbosity levels sharing a
+   stream share its format state.  Every line is tagged with the verbosity level of this SPxOut at the time the line
+   was started.  Every complete line becomes one record, which is stored in a bounded ring buffer
+   and written to the target stream by a background thread, so the solver thread never waits for the target stream
+   to be written or flushed.  Incomplete lines are kept until they are terminated, and records are written as a whole
+   under a lock shared by all sinks, such that the output of several instances sharing a process does not interleave
+   within lines.
+
+   The ring buffer is lock-free for one producer and one consumer, hence a sink must only be written to by one thread
+   at a time, as is the case for the SPxOut of one SoPlex instance.  If the buffer is full, the writing thread waits
+   until the background thread has taken a record, which bounds the memory used for buffering.
+
+   With structured output, every record is prefixed by the tag of the sink, the verbosity level and the time in
+   seconds since the sink was created, e.g., "[lp1 INFO1 0.125] ".
+*/
+class SPxOutAsyncSink
+{
+public:
+
+   /// constructor writing to \p out and \p err, buffering at most \p capacity records
+   explicit SPxOutAsyncSink(std::ostream& out = std::cout, std::ostream& err = std::cerr, int capacity = 4096,
+                            bool structured = false, const std::string& tag = "");
+
+   /// destructor, writes all remaining records
+   ~SPxOutAsyncSink();
+
+   /// returns the stream collecting the records of verbosity level \p verbosity
+   std::ostream& stream(SPxOut::Verbosity verbosity)
+   {
+      return (verbosity <= SPxOut::WARNING) ? *m_streams[0] : *m_streams[1];
+   }
+
+   /// waits until all complete records have been written and flushes the target streams
+   void flush();
+
+   /// number of records written so far
+   long long numRecords() const
+   {
+      return m_numWritten;
+   }
+
+   /// number of times the writing thread had to wait for free space in the buffer
+   long long numWaits() const
+   {
+      return m_numWaits;
+   }
+
+private:
+
+   /// one line of output
+   struct Record
+   {
+      int level;              ///< verbosity level
+      double time;            ///< seconds since the sink was created
+      std::string text;       ///< text including the terminating newline
+   };
+
+   /// stream buffer collecting the lines of one stream
+   class LineBuf : public std::streambuf
+   {
+   public:
+      explicit LineBuf(SPxOutAsyncSink* sink)
+         : m_sink(sink)
+         , m_level(SPxOut::INFO1)
+      {}
+
+      /// hands over an incomplete line
+      void finish();
+
+   protected:
+      virtual int_type overflow(int_type c);
+      virtual std::streamsize xsputn(const char* s, std::streamsize n);
+
+   private:
+      /// appends a character to the line, which starts a record at the current level of the sink
+      void append(char c);
+
+      SPxOutAsyncSink* m_sink;
+      int m_level;
+      std::string m_line;
+   };
+
+   friend class SPxOut;
+
+   /// appends a record to the ring buffer, waiting if it is full
+   void push(int level, std::string& text);
+
+   /// writes a record to the target stream
+   void write(const Record& rec);
+
+   /// main loop of the background thread
+   void run();
+
+   SPxOutAsyncSink(const SPxOutAsyncSink&);
+   SPxOutAsyncSink& operator=(const SPxOutAsyncSink&);
+
+   std::ostream& m_out;                                  ///< target stream for info and debug records
+   std::ostream& m_err;                                  ///< target stream for error and warning records
+   bool m_structured;                                    ///< prefix records by tag, level and time?
+   std::string m_tag;                                    ///< tag of the records
+   std::chrono::steady_clock::time_point m_start;        ///< time the sink was created
+   std::vector<Record> m_ring;                           ///< ring buffer of records
+   std::atomic<size_t> m_head;                           ///< number of records taken by the background thread
+   std::atomic<size_t> m_tail;                           ///< number of records appended by the writing thread
+   std::atomic<bool> m_stop;                             ///< should the background thread stop?
+   std::atomic<long long> m_numWritten;                  ///< number of records written
+   long long m_numWaits;                                 ///< number of waits for free space
+   const SPxOut* m_owner;                                ///< SPxOut the sink was set for, provides the verbosity
+   std::vector<LineBuf*> m_bufs;                         ///< stream buffers of the error and output stream
+   std::vector<std::ostream*> m_streams;                 ///< error and output stream
+   std::thread m_thread;                                 ///< background thread
+};
+
+} // namespace soplex
+
+#endif // _SPXOUTSINK_H_
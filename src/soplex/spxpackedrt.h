@@ -0,0 +1,154 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+/**@file  spxpackedrt.h
+ * @brief Harris ratio test on packed candidate arrays.
+ */
+#ifndef _SPXPACKEDRT_H_
+#define _SPXPACKEDRT_H_
+
+#include <assert.h>
+#include <vector>
+
+#include "soplex/spxdefines.h"
+#include "soplex/spxratiotester.h"
+
+namespace soplex
+{
+
+/**@brief   Harris ratio test with shifting on packed candidate arrays.
+   @ingroup Algo
+
+   Class SPxPackedRT implements the same two phase ratio test with shifting
+   of bounds as SPxHarrisRT.  Instead of looking up the update value, the
+   current value and both bounds of a candidate by its index in every phase,
+   it gathers the data of all nonzero update entries into contiguous arrays
+   once, normalized such that the step is always taken in positive
+   direction.  The first phase then is a plain minimum reduction over these
+   arrays, which the compiler can vectorize, and the second phase reads the
+   candidates sequentially.  Memory is only accessed by index again for the
+   few candidates whose bounds are shifted or which are selected.
+
+   See SPxRatioTester for a class documentation.
+*/
+template <class R>
+class SPxPackedRT : public SPxRatioTester<R>
+{
+private:
+
+   //-------------------------------------
+   /**@name Packed candidates */
+   ///@{
+   /// candidates of one update vector
+   struct Candidates
+   {
+      int num;                ///< number of candidates, same as the size of the update vector
+      std::vector<R> upd;     ///< update value, negated if the step is negative
+      std::vector<R> gap;     ///< distance from the current value to the bound approached by the step
+      std::vector<R> stepNum; ///< numerator of the phase 1 ratio, infinity if the candidate is irrelevant
+      std::vector<R> stepDen; ///< denominator of the phase 1 ratio, 1 if the candidate is irrelevant
+
+      Candidates()
+         : num(0)
+      {}
+   };
+
+   Candidates leaveCand;      ///< candidates of the leaving ratio test
+   Candidates pCand;          ///< candidates of the columns of the entering ratio test
+   Candidates coCand;         ///< candidates of the rows of the entering ratio test
+   ///@}
+
+   //-------------------------------------
+   /**@name Private helpers */
+   ///@{
+   ///
+   R degenerateEps() const;
+
+   /// gathers the entries of \p upd into \p cand for a step in direction \p dir; the k-th candidate is the k-th
+   /// entry of the index set of \p upd
+   void pack(
+      Candidates& cand,     ///< packed candidates
+      R dir,                ///< 1 for a positive, -1 for a negative step
+      const SSVectorBase<R>& upd,  ///< update vector for \p vec
+      const R* vec,         ///< current vector
+      const R* low,         ///< lower bounds for \p vec
+      const R* up,          ///< upper bounds for \p vec
+      R epsilon             ///< what is 0?
+   ) const;
+
+   /// phase 1: returns the minimum of \p val and the maximal steps of all candidates
+   R minRatio(const Candidates& cand, R val) const;
+   ///@}
+
+public:
+
+   //-------------------------------------
+   /**@name Construction / destruction */
+   ///@{
+   /// default constructor
+   SPxPackedRT()
+      : SPxRatioTester<R>("Packed")
+   {}
+   /// copy constructor
+   SPxPackedRT(const SPxPackedRT& old)
+      : SPxRatioTester<R>(old)
+   {}
+   /// assignment operator
+   SPxPackedRT& operator=(const SPxPackedRT& rhs)
+   {
+      if(this != &rhs)
+      {
+         SPxRatioTester<R>::operator=(rhs);
+      }
+
+      return *this;
+   }
+   /// destructor
+   virtual ~SPxPackedRT()
+   {}
+   /// clone function for polymorphism
+   inline virtual SPxRatioTester<R>* clone() const
+   {
+      return new SPxPackedRT(*this);
+   }
+   ///@}
+
+   //-------------------------------------
+   /**@name Leave / enter */
+   ///@{
+   ///
+   virtual int selectLeave(R& val, R, bool);
+   ///
+   virtual SPxId selectEnter(R& val, int, bool);
+   ///@}
+
+};
+
+} // namespace soplex
+// For the general template
+#include "spxpackedrt.hpp"
+
+
+#endif // _SPXPACKEDRT_H_
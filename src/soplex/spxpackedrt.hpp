@@ -0,0 +1,445 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+namespace soplex
+{
+template <class R>
+R SPxPackedRT<R>::degenerateEps() const
+{
+   return this->solver()->delta()
+          * (1.0 - this->solver()->numCycle() / this->solver()->maxCycle());
+}
+
+/* The step is normalized to be positive: the update values are multiplied by dir, such that a positive value moves
+ * towards the upper bound and a negative value towards the lower bound.  This is the only pass which accesses the
+ * vectors by index.
+ */
+template <class R>
+void SPxPackedRT<R>::pack(
+   Candidates& cand,
+   R dir,
+   const SSVectorBase<R>& upd,
+   const R* vec,
+   const R* low,
+   const R* up,
+   R epsilon) const
+{
+   const int num = upd.size();
+   const int* idx = upd.indexMem();
+   const R* values = upd.values();
+
+   if(int(cand.upd.size()) < num)
+   {
+      cand.upd.resize(num);
+      cand.gap.resize(num);
+      cand.stepNum.resize(num);
+      cand.stepDen.resize(num);
+   }
+
+   cand.num = num;
+
+   for(int k = 0; k < num; ++k)
+   {
+      const int i = idx[k];
+      const R x = dir * values[i];
+
+      if(x > 0)
+      {
+         cand.gap[k] = up[i] - vec[i];
+
+         if(x > epsilon && up[i] < R(infinity))
+         {
+            cand.stepNum[k] = cand.gap[k] + this->delta;
+            cand.stepDen[k] = x;
+         }
+         else
+         {
+            cand.stepNum[k] = R(infinity);
+            cand.stepDen[k] = 1;
+         }
+      }
+      else
+      {
+         cand.gap[k] = low[i] - vec[i];
+
+         if(x < -epsilon && low[i] > R(-infinity))
+         {
+            cand.stepNum[k] = cand.gap[k] - this->delta;
+            cand.stepDen[k] = x;
+         }
+         else
+         {
+            cand.stepNum[k] = R(infinity);
+            cand.stepDen[k] = 1;
+         }
+      }
+
+      cand.upd[k] = x;
+   }
+}
+
+/* Irrelevant candidates have a ratio of infinity, so this is a branch free minimum over contiguous arrays. */
+template <class R>
+R SPxPackedRT<R>::minRatio(const Candidates& cand, R val) const
+{
+   const R* stepNum = cand.stepNum.data();
+   const R* stepDen = cand.stepDen.data();
+   R theval = val;
+
+   assert(val >= 0);
+
+   for(int k = 0; k < cand.num; ++k)
+   {
+      const R x = stepNum[k] / stepDen[k];
+      theval = (x < theval) ? x : theval;
+   }
+
+   return theval;
+}
+
+/**
+   The same two phase procedure as in SPxHarrisRT::selectLeave(), working on
+   the packed candidates for a step in positive direction.
+*/
+template <class R>
+int SPxPackedRT<R>::selectLeave(R& val, R, bool)
+{
+   int j;
+   R stab, x, y;
+   R max;
+   R sel;
+   R lastshift;
+   R dir;
+   int leave = -1;
+
+   R epsilon  = this->solver()->epsilon();
+   R degeneps = degenerateEps();
+
+   SSVectorBase<R>& upd = this->solver()->fVec().delta();
+   VectorBase<R>& vec = this->solver()->fVec();
+
+   const VectorBase<R>& up = this->solver()->ubBound();
+   const VectorBase<R>& low = this->solver()->lbBound();
+
+   assert(this->delta > epsilon);
+   assert(epsilon > 0);
+   assert(this->solver()->maxCycle() > 0);
+
+   if(val > epsilon)
+      dir = 1;
+   else if(val < -epsilon)
+      dir = -1;
+   else
+      return -1;
+
+   lastshift = this->solver()->shift();
+
+   this->solver()->fVec().delta().setup();
+
+   pack(leaveCand, dir, upd, vec.get_const_ptr(), low.get_const_ptr(), up.get_const_ptr(), epsilon);
+
+   // phase 1:
+   max = minRatio(leaveCand, dir * val);
+
+   if(max == dir * val)
+      return -1;
+
+   // phase 2:
+   stab = 0;
+   sel = R(-infinity);
+
+   for(j = leaveCand.num - 1; j >= 0; --j)
+   {
+      x = leaveCand.upd[j];
+
+      if(x > epsilon || x < -epsilon)
+      {
+         y = leaveCand.gap[j];
+
+         if(x > 0 && y < -degeneps)
+         {
+            int i = upd.index(j);
+            this->solver()->shiftUBbound(i, vec[i]); // ensure simplex improvement
+         }
+         else if(x < 0 && y > degeneps)
+         {
+            int i = upd.index(j);
+            this->solver()->shiftLBbound(i, vec[i]); // ensure simplex improvement
+         }
+         else
+         {
+            y /= x;
+
+            if(y <= max && y > sel - epsilon && spxAbs(x) > stab)
+            {
+               sel = y;
+               leave = upd.index(j);
+               stab = spxAbs(x);
+            }
+         }
+      }
+      else
+         upd.clearNum(j);
+   }
+
+   if(lastshift != this->solver()->shift())
+      return selectLeave(val, 0, false);
+
+   assert(leave >= 0);
+
+   val = dir * sel;
+   return leave;
+}
+
+/**
+   The same two phase procedure as in SPxHarrisRT::selectEnter(), working on
+   the packed candidates of both update vectors.  The candidates are gathered
+   anew whenever the ratio test is repeated, since bounds, values and update
+   vectors may have been changed in the meantime.
+*/
+template <class R>
+SPxId SPxPackedRT<R>::selectEnter(R& val, int, bool)
+{
+   int i, j;
+   SPxId enterId;
+   R stab, x, y;
+   R max = 0.0;
+   R sel = 0.0;
+   R lastshift;
+   R useeps;
+   R shiftdist;
+   R dir;
+   int pnr, cnr;
+
+   R minStability = 0.0001;
+   R epsilon      = this->solver()->epsilon();
+   R degeneps     = degenerateEps();
+
+   VectorBase<R>& pvec = this->solver()->pVec();
+   SSVectorBase<R>& pupd = this->solver()->pVec().delta();
+
+   VectorBase<R>& cvec = this->solver()->coPvec();
+   SSVectorBase<R>& cupd = this->solver()->coPvec().delta();
+
+   const VectorBase<R>& upb = this->solver()->upBound();
+   const VectorBase<R>& lpb = this->solver()->lpBound();
+   const VectorBase<R>& ucb = this->solver()->ucBound();
+   const VectorBase<R>& lcb = this->solver()->lcBound();
+
+   assert(this->delta > epsilon);
+   assert(epsilon > 0);
+   assert(this->solver()->maxCycle() > 0);
+
+   this->solver()->coPvec().delta().setup();
+   this->solver()->pVec().delta().setup();
+
+   if(val > epsilon)
+   {
+      dir = 1;
+      useeps = epsilon;
+      shiftdist = degeneps;
+   }
+   else if(val < -epsilon)
+   {
+      // as in SPxHarrisRT, negative steps use a smaller threshold, shift to the current value and
+      // prefer the first of several equally stable candidates
+      dir = -1;
+      useeps = epsilon * 0.001;
+      shiftdist = 0;
+   }
+   else
+      return enterId;
+
+   for(;;)
+   {
+      pnr = -1;
+      cnr = -1;
+      lastshift = this->solver()->shift();
+      assert(this->delta > epsilon);
+
+      pack(pCand, dir, pupd, pvec.get_const_ptr(), lpb.get_const_ptr(), upb.get_const_ptr(), epsilon);
+      pack(coCand, dir, cupd, cvec.get_const_ptr(), lcb.get_const_ptr(), ucb.get_const_ptr(), epsilon);
+
+      // phase 1:
+      max = minRatio(pCand, dir * val);
+      max = minRatio(coCand, max);
+
+      if(max == dir * val)
+         return enterId;
+
+      // phase 2:
+      stab = 0;
+      sel = R(-infinity);
+
+      for(j = pCand.num - 1; j >= 0; --j)
+      {
+         x = pCand.upd[j];
+
+         if(x > useeps || x < -useeps)
+         {
+            y = pCand.gap[j];
+
+            if(x > 0 && y < -degeneps)
+            {
+               i = pupd.index(j);
+               this->solver()->shiftUPbound(i, pvec[i] - dir * shiftdist);
+            }
+            else if(x < 0 && y > degeneps)
+            {
+               i = pupd.index(j);
+               this->solver()->shiftLPbound(i, pvec[i] + dir * shiftdist);
+            }
+            else
+            {
+               y /= x;
+
+               if(y <= max && (spxAbs(x) > stab || (dir > 0 && spxAbs(x) == stab)))
+               {
+                  i = pupd.index(j);
+                  enterId = this->solver()->id(i);
+                  sel = y;
+                  pnr = i;
+                  stab = spxAbs(x);
+               }
+            }
+         }
+         else
+         {
+            MSG_DEBUG(std::cout << "DPACKR01 removing value " << pupd[pupd.index(j)] << std::endl;)
+            pupd.clearNum(j);
+         }
+      }
+
+      for(j = coCand.num - 1; j >= 0; --j)
+      {
+         x = coCand.upd[j];
+
+         if(x > useeps || x < -useeps)
+         {
+            y = coCand.gap[j];
+
+            if(x > 0 && y < -degeneps)
+            {
+               i = cupd.index(j);
+               this->solver()->shiftUCbound(i, cvec[i] - dir * shiftdist);
+            }
+            else if(x < 0 && y > degeneps)
+            {
+               i = cupd.index(j);
+               this->solver()->shiftLCbound(i, cvec[i] + dir * shiftdist);
+            }
+            else
+            {
+               y /= x;
+
+               if(y <= max && (spxAbs(x) > stab || (dir > 0 && spxAbs(x) == stab)))
+               {
+                  enterId = this->solver()->coId(cupd.index(j));
+                  sel = y;
+                  cnr = j;
+                  stab = spxAbs(x);
+               }
+            }
+         }
+         else
+         {
+            MSG_DEBUG(std::cout << "DPACKR02 removing value " << cupd[cupd.index(j)] << std::endl;)
+            cupd.clearNum(j);
+         }
+      }
+
+      if(lastshift == this->solver()->shift())
+      {
+         if(cnr >= 0)
+         {
+            if(this->solver()->isBasic(enterId))
+            {
+               cupd.clearNum(cnr);
+               continue;
+            }
+            else
+               break;
+         }
+         else if(pnr >= 0)
+         {
+            pvec[pnr] = this->solver()->vector(pnr) * cvec;
+
+            if(this->solver()->isBasic(enterId))
+            {
+               pupd.setValue(pnr, 0.0);
+               continue;
+            }
+            else
+            {
+               x = dir * pupd[pnr];
+
+               if(x > 0)
+               {
+                  sel = upb[pnr] - pvec[pnr];
+
+                  if(x < minStability && sel < this->delta)
+                  {
+                     minStability /= 2.0;
+                     this->solver()->shiftUPbound(pnr, pvec[pnr]);
+                     continue;
+                  }
+               }
+               else
+               {
+                  sel = lpb[pnr] - pvec[pnr];
+
+                  if(-x < minStability && -sel < this->delta)
+                  {
+                     minStability /= 2.0;
+                     this->solver()->shiftLPbound(pnr, pvec[pnr]);
+                     continue;
+                  }
+               }
+
+               sel /= x;
+            }
+         }
+         else
+         {
+            val = 0;
+            enterId.inValidate();
+            return enterId;
+         }
+
+         if(sel > max)              // instability detected => recompute
+            continue;               // ratio test with corrected value
+
+         break;
+      }
+   }
+
+   assert(max >= 0);
+   assert(enterId.type() != SPxId::INVALID);
+
+   val = dir * sel;
+
+   return enterId;
+}
+} // namespace soplex
@@ -60,6 +60,12 @@ public:
       return new Presol(*this);
    }
 
+   void
+   setThreads(int value)
+   {
+      ;
+   }
+
    virtual typename SPxSimplifier<R>::Result simplify(SPxLPBase<R>& lp, R eps, R delta,
          Real remainingTime)
    {
@@ -158,7 +164,9 @@ public:
 
 #else
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "papilo/core/Presolve.hpp"
 #include "papilo/core/ProblemBuilder.hpp"
@@ -171,6 +179,7 @@ public:
 #include "soplex/array.h"
 #include "soplex/exceptions.h"
 #include "soplex/spxdefines.h"
+#include "soplex/spxthreads.h"
 
 
 namespace soplex
@@ -205,6 +214,8 @@ private:
    R m_feastol;                 ///< primal feasibility tolerance.
    R m_opttol;                  ///< dual feasibility tolerance.
    R modifyRowsFac;             ///<
+   int m_threads;               ///< number of threads used by PaPILO and the problem conversion
+   size_t m_peakMemory;         ///< estimated peak number of bytes of matrix data held during the last presolve
    DataArray<int> m_stat;       ///< preprocessing history.
    typename SPxLPBase<R>::SPxSense m_thesense;   ///< optimization sense.
 
@@ -247,7 +258,7 @@ public:
    explicit Presol(Timer::TYPE ttype = Timer::USER_TIME)
       : SPxSimplifier<R>("PaPILO", ttype), postsolved(false), m_epsilon(DEFAULT_EPS_ZERO),
         m_feastol(DEFAULT_BND_VIOL), m_opttol(DEFAULT_BND_VIOL), modifyRowsFac(1.0),
-        m_thesense(SPxLPBase<R>::MAXIMIZE),
+        m_threads(1), m_peakMemory(0), m_thesense(SPxLPBase<R>::MAXIMIZE),
         m_keepbounds(false), m_result(this->OKAY)
    { ; };
 
@@ -257,7 +268,8 @@ public:
         m_redCost(old.m_redCost), m_cBasisStat(old.m_cBasisStat), m_rBasisStat(old.m_rBasisStat),
         postsolveStorage(old.postsolveStorage), postsolved(old.postsolved), m_epsilon(old.m_epsilon),
         m_feastol(old.m_feastol), m_opttol(old.m_opttol),
-        modifyRowsFac(old.modifyRowsFac), m_thesense(old.m_thesense),
+        modifyRowsFac(old.modifyRowsFac), m_threads(old.m_threads), m_peakMemory(old.m_peakMemory),
+        m_thesense(old.m_thesense),
         m_keepbounds(old.m_keepbounds), m_result(old.m_result)
    {
       ;
@@ -284,6 +296,8 @@ public:
          m_result = rhs.m_result;
          postsolveStorage = rhs.postsolveStorage;
          modifyRowsFac = rhs.modifyRowsFac;
+         m_threads = rhs.m_threads;
+         m_peakMemory = rhs.m_peakMemory;
       }
 
       return *this;
@@ -306,6 +320,19 @@ public:
       modifyRowsFac = value;
    }
 
+   void
+   setThreads(int value)
+   {
+      assert(value >= 1);
+      m_threads = value;
+   }
+
+   /// estimated peak number of bytes of matrix data held during the last presolve
+   virtual size_t peakMemory() const
+   {
+      return m_peakMemory;
+   }
+
    void
    setEnableSingletonCols(bool value)
    {
@@ -447,11 +474,56 @@ private:
    void configurePapilo(papilo::Presolve<R>& presolve, R feasTolerance, R epsilon, uint32_t seed,
                         Real remainingTime) const;
 
-   void applyPresolveResultsToColumns(SPxLPBase <R>& lp, const papilo::Problem<R>& problem,
-                                      const papilo::PresolveResult<R>& res) const;
+   /// LP data in compressed row format, used to hand the problem over to PaPILO and back
+   struct LPData
+   {
+      std::vector<R> obj;
+      std::vector<R> lower;
+      std::vector<R> upper;
+      std::vector<R> lhs;
+      std::vector<R> rhs;
+      std::vector<int> rowStarts;
+      std::vector<int> rowLengths;
+      std::vector<int> indices;
+      std::vector<R> values;
+      R objOffset = 0;
+
+      /// number of bytes allocated
+      size_t memory() const
+      {
+         return (obj.capacity() + lower.capacity() + upper.capacity() + lhs.capacity() + rhs.capacity()
+                 + values.capacity()) * sizeof(R)
+                + (rowStarts.capacity() + rowLengths.capacity() + indices.capacity()) * sizeof(int);
+      }
+
+      /// releases all memory
+      void clear()
+      {
+         LPData empty;
+         std::swap(*this, empty);
+      }
+   };
+
+   /// estimated number of bytes of a PaPILO problem with \p nnz nonzeros stored row- and column-wise
+   static size_t problemMemory(int nnz)
+   {
+      return 2 * size_t(nnz) * (sizeof(R) + sizeof(int));
+   }
+
+   void updatePeakMemory(size_t bytes)
+   {
+      m_peakMemory = std::max(m_peakMemory, bytes);
+   }
+
+   void extractLP(const SPxLPBase <R>& lp, LPData& data) const;
+
+   void releaseLP(SPxLPBase <R>& lp) const;
 
-   void applyPresolveResultsToRows(SPxLPBase <R>& lp, const papilo::Problem<R>& problem,
-                                   const papilo::PresolveResult<R>& res) const;
+   papilo::Problem<R> buildProblem(const LPData& data) const;
+
+   void extractPresolveResults(const papilo::Problem<R>& problem, LPData& data) const;
+
+   void loadLP(SPxLPBase <R>& lp, const LPData& data) const;
 
    papilo::VarBasisStatus
    convertToPapiloStatus(typename SPxSolverBase<R>::VarStatus status) const;
@@ -632,33 +704,100 @@ Presol<R>::convertToSoplexStatus(papilo::VarBasisStatus status) const
 
 
 template<class R>
-papilo::Problem<R> buildProblem(SPxLPBase<R>& lp)
+void Presol<R>::extractLP(const SPxLPBase<R>& lp, LPData& data) const
+{
+   int ncols = lp.nCols();
+   int nrows = lp.nRows();
+
+   data.obj.resize(ncols);
+   data.lower.resize(ncols);
+   data.upper.resize(ncols);
+   data.lhs.resize(nrows);
+   data.rhs.resize(nrows);
+   data.rowStarts.resize(nrows);
+   data.rowLengths.resize(nrows);
+
+   int nnz = 0;
+
+   for(int i = 0; i < nrows; ++i)
+   {
+      data.rowStarts[i] = nnz;
+      data.rowLengths[i] = lp.rowVector(i).size();
+      nnz += data.rowLengths[i];
+   }
+
+   data.indices.resize(nnz);
+   data.values.resize(nnz);
+   data.objOffset = lp.objOffset();
+
+   spxParallelForRange(m_threads, ncols, [&](int first, int last)
+   {
+      for(int j = first; j < last; ++j)
+      {
+         data.obj[j] = lp.obj(j);
+         data.lower[j] = lp.lower(j);
+         data.upper[j] = lp.upper(j);
+      }
+   });
+
+   spxParallelForRange(m_threads, nrows, [&](int first, int last)
+   {
+      for(int i = first; i < last; ++i)
+      {
+         const SVectorBase<R>& rowVector = lp.rowVector(i);
+
+         for(int j = 0, k = data.rowStarts[i]; j < rowVector.size(); ++j, ++k)
+         {
+            data.indices[k] = rowVector.index(j);
+            data.values[k] = rowVector.value(j);
+         }
+
+         data.lhs[i] = lp.lhs(i);
+         data.rhs[i] = lp.rhs(i);
+      }
+   });
+}
+
+template<class R>
+void Presol<R>::releaseLP(SPxLPBase<R>& lp) const
+{
+   // remove all constraints and variables in one pass each
+   if(lp.nCols() > 0)
+      lp.removeColRange(0, lp.nCols() - 1);
+
+   if(lp.nRows() > 0)
+      lp.removeRowRange(0, lp.nRows() - 1);
+
+   lp.packNzoMemory();
+}
+
+template<class R>
+papilo::Problem<R> Presol<R>::buildProblem(const LPData& data) const
 {
    papilo::ProblemBuilder<R> builder;
 
    /* build problem from matrix */
-   int nnz = lp.nNzos();
-   int ncols = lp.nCols();
-   int nrows = lp.nRows();
+   int nnz = (int) data.values.size();
+   int ncols = (int) data.obj.size();
+   int nrows = (int) data.lhs.size();
    builder.reserve(nnz, nrows, ncols);
 
    /* set up columns */
    builder.setNumCols(ncols);
 
-   R switch_sign = lp.spxSense() == SPxLPBase<R>::MAXIMIZE ? -1 : 1;
+   R switch_sign = m_thesense == SPxLPBase<R>::MAXIMIZE ? -1 : 1;
 
    for(int i = 0; i < ncols; ++i)
    {
-      R lowerbound = lp.lower(i);
-      R upperbound = lp.upper(i);
-      R objective = lp.obj(i);
+      R lowerbound = data.lower[i];
+      R upperbound = data.upper[i];
       builder.setColLb(i, lowerbound);
       builder.setColUb(i, upperbound);
       builder.setColLbInf(i, lowerbound <= -R(infinity));
       builder.setColUbInf(i, upperbound >= R(infinity));
 
       builder.setColIntegral(i, false);
-      builder.setObj(i, objective * switch_sign);
+      builder.setObj(i, data.obj[i] * switch_sign);
    }
 
    /* set up rows */
@@ -666,22 +805,11 @@ papilo::Problem<R> buildProblem(SPxLPBase<R>& lp)
 
    for(int i = 0; i < nrows; ++i)
    {
-      const SVectorBase<R> rowVector = lp.rowVector(i);
-      int rowlength = rowVector.size();
-      int* indices = new int[rowlength];
-      R* rowValues = new R[rowlength];
+      int start = data.rowStarts[i];
+      builder.addRowEntries(i, data.rowLengths[i], data.indices.data() + start, data.values.data() + start);
 
-      for(int j = 0; j < rowlength; j++)
-      {
-         const Nonzero<R> element = rowVector.element(j);
-         indices[j] = element.idx;
-         rowValues[j] = element.val;
-      }
-
-      builder.addRowEntries(i, rowlength, indices, rowValues);
-
-      R lhs = lp.lhs(i);
-      R rhs = lp.rhs(i);
+      R lhs = data.lhs[i];
+      R rhs = data.rhs[i];
       builder.setRowLhs(i, lhs);
       builder.setRowRhs(i, rhs);
       builder.setRowLhsInf(i, lhs <= -R(infinity));
@@ -707,85 +835,107 @@ Presol<R>::simplify(SPxLPBase<R>& lp, R eps, R ftol, R otol,
 
       initLocalVariables(lp);
 
-   papilo::Problem<R> problem = buildProblem(lp);
-   papilo::Presolve<R> presolve;
-
-   configurePapilo(presolve, ftol, eps, seed, remainingTime);
-   MSG_INFO1((*this->spxout), (*this->spxout)
-             << " --- starting PaPILO" << std::endl;
-            )
+   // hand the LP over to PaPILO in compressed row format and release the matrix of the LP in the meantime; the
+   // compressed copy is kept to restore the LP in case the presolved problem is not used
+   int origRows = lp.nRows();
+   int origNzos = lp.nNzos();
+   LPData data;
 
-   papilo::PresolveResult<R> res = presolve.apply(problem);
+   m_peakMemory = lp.nzoMemory();
+   extractLP(lp, data);
+   updatePeakMemory(lp.nzoMemory() + data.memory());
+   releaseLP(lp);
 
-   assert(res.postsolve.postsolveType == PostsolveType::kFull);
+   int newNonzeros;
 
-   switch(res.status)
    {
-   case papilo::PresolveStatus::kInfeasible:
-      m_result = SPxSimplifier<R>::INFEASIBLE;
-      MSG_INFO1((*this->spxout), (*this->spxout)
-                << " --- presolving detected infeasibility" << std::endl;
-               )
-      return SPxSimplifier<R>::INFEASIBLE;
+      papilo::Problem<R> problem = buildProblem(data);
+      papilo::Presolve<R> presolve;
 
-   case papilo::PresolveStatus::kUnbndOrInfeas:
-   case papilo::PresolveStatus::kUnbounded:
-      m_result = SPxSimplifier<R>::UNBOUNDED;
-      MSG_INFO1((*this->spxout), (*this->spxout) <<
-                "==== Presolving detected unboundedness of the problem" << std::endl;
-               )
-      return SPxSimplifier<R>::UNBOUNDED;
+      // during the build, the problem builder holds an additional copy of the nonzeros as triplets
+      updatePeakMemory(data.memory() + problemMemory(origNzos) + size_t(origNzos) * (sizeof(R) + 2 * sizeof(
+                          int)));
 
-   case papilo::PresolveStatus::kUnchanged:
-      // since Soplex has no state unchanged store the value in a new variable
-      noChanges = true;
+      configurePapilo(presolve, ftol, eps, seed, remainingTime);
       MSG_INFO1((*this->spxout), (*this->spxout)
-                << "==== Presolving found nothing " << std::endl;
+                << " --- starting PaPILO" << std::endl;
                )
-      return SPxSimplifier<R>::OKAY;
 
-   case papilo::PresolveStatus::kReduced:
-      break;
-   }
+      papilo::PresolveResult<R> res = presolve.apply(problem);
 
+      assert(res.postsolve.postsolveType == PostsolveType::kFull);
 
-   int newNonzeros = problem.getConstraintMatrix().getNnz();
+      switch(res.status)
+      {
+      case papilo::PresolveStatus::kInfeasible:
+         m_result = SPxSimplifier<R>::INFEASIBLE;
+         MSG_INFO1((*this->spxout), (*this->spxout)
+                   << " --- presolving detected infeasibility" << std::endl;
+                  )
+         loadLP(lp, data);
+         return SPxSimplifier<R>::INFEASIBLE;
+
+      case papilo::PresolveStatus::kUnbndOrInfeas:
+      case papilo::PresolveStatus::kUnbounded:
+         m_result = SPxSimplifier<R>::UNBOUNDED;
+         MSG_INFO1((*this->spxout), (*this->spxout) <<
+                   "==== Presolving detected unboundedness of the problem" << std::endl;
+                  )
+         loadLP(lp, data);
+         return SPxSimplifier<R>::UNBOUNDED;
+
+      case papilo::PresolveStatus::kUnchanged:
+         // since Soplex has no state unchanged store the value in a new variable
+         noChanges = true;
+         MSG_INFO1((*this->spxout), (*this->spxout)
+                   << "==== Presolving found nothing " << std::endl;
+                  )
+         loadLP(lp, data);
+         return SPxSimplifier<R>::OKAY;
+
+      case papilo::PresolveStatus::kReduced:
+         break;
+      }
 
-   if(newNonzeros == 0 || ((problem.getNRows() <= modifyRowsFac * lp.nRows() ||
-                            newNonzeros <= modifyRowsFac * lp.nNzos())))
-   {
-      MSG_INFO1((*this->spxout), (*this->spxout)
-                << " --- presolved problem has " << problem.getNRows() <<
-                " rows, "
-                << problem.getNCols() << " cols and "
-                << newNonzeros << " non-zeros and  "
-                << presolve.getStatistics().nboundchgs << " boundchanges and "
-                << presolve.getStatistics().nsidechgs << " sidechanges"
-                << std::endl;
-               )
-      postsolveStorage = res.postsolve;
 
-      // remove all constraints and variables
-      for(int j = lp.nCols() - 1; j >= 0; j--)
-         lp.removeCol(j);
+      newNonzeros = problem.getConstraintMatrix().getNnz();
 
-      for(int i = lp.nRows() - 1; i >= 0; i--)
-         lp.removeRow(i);
+      if(newNonzeros == 0 || ((problem.getNRows() <= modifyRowsFac * origRows ||
+                               newNonzeros <= modifyRowsFac * origNzos)))
+      {
+         MSG_INFO1((*this->spxout), (*this->spxout)
+                   << " --- presolved problem has " << problem.getNRows() <<
+                   " rows, "
+                   << problem.getNCols() << " cols and "
+                   << newNonzeros << " non-zeros and  "
+                   << presolve.getStatistics().nboundchgs << " boundchanges and "
+                   << presolve.getStatistics().nsidechgs << " sidechanges"
+                   << std::endl;
+                  )
+         assert(problem.getNRows() == (int) res.postsolve.origrow_mapping.size());
+         postsolveStorage = std::move(res.postsolve);
+
+         // the original LP is not needed anymore, replace it by the presolved problem
+         data.clear();
+         extractPresolveResults(problem, data);
+         updatePeakMemory(data.memory() + problemMemory(newNonzeros));
+      }
+      else
+      {
+         noChanges = true;
+         MSG_INFO1((*this->spxout),
+                   (*this->spxout)
 
-      applyPresolveResultsToColumns(lp, problem, res);
-      applyPresolveResultsToRows(lp, problem, res);
-      assert(newNonzeros == lp.nNzos());
+                   << " --- presolve results smaller than the modifyconsfac"
+                   << std::endl;
+                  )
+      }
    }
-   else
-   {
-      noChanges = true;
-      MSG_INFO1((*this->spxout),
-                (*this->spxout)
 
-                << " --- presolve results smaller than the modifyconsfac"
-                << std::endl;
-               )
-   }
+   // the PaPILO problem has been released at this point
+   loadLP(lp, data);
+   updatePeakMemory(lp.nzoMemory() + data.memory());
+   assert(noChanges || newNonzeros == lp.nNzos());
 
    if(newNonzeros == 0)
    {
@@ -793,6 +943,11 @@ Presol<R>::simplify(SPxLPBase<R>& lp, R eps, R ftol, R otol,
       m_result = SPxSimplifier<R>::VANISHED;
    }
 
+   MSG_INFO2((*this->spxout), (*this->spxout)
+             << " --- estimated peak memory of matrix data during presolving: "
+             << m_peakMemory / 1048576.0 << " MB" << std::endl;
+            )
+
    return m_result;
 }
 
@@ -803,6 +958,8 @@ void Presol<R>::initLocalVariables(const SPxLPBase <R>& lp)
 
    m_thesense = lp.spxSense();
    postsolved = false;
+   noChanges = false;
+   vanished = false;
 
    m_prim.reDim(lp.nCols());
    m_slack.reDim(lp.nRows());
@@ -825,8 +982,7 @@ void Presol<R>::configurePapilo(papilo::Presolve<R>& presolve, R feasTolerance,
    presolve.getPresolveOptions().randomseed = (unsigned int) seed;
 
    /* set number of threads to be used for presolve */
-   /* TODO: set threads for PaPILO? Can Soplex be run with multiple threads?*/
-   //      presolve.getPresolveOptions().threads = data->threads;
+   presolve.getPresolveOptions().threads = m_threads;
 
    presolve.getPresolveOptions().tlim = remainingTime;
    presolve.getPresolveOptions().feastol = double(feasTolerance);
@@ -883,80 +1039,92 @@ void Presol<R>::configurePapilo(papilo::Presolve<R>& presolve, R feasTolerance,
 }
 
 template<class R>
-void Presol<R>::applyPresolveResultsToColumns(SPxLPBase <R>& lp, const papilo::Problem<R>& problem,
-      const papilo::PresolveResult<R>& res) const
+void Presol<R>::extractPresolveResults(const papilo::Problem<R>& problem, LPData& data) const
 {
-
    const papilo::Objective<R>& objective = problem.getObjective();
    const papilo::Vec<R>& upperBounds = problem.getUpperBounds();
    const papilo::Vec<R>& lowerBounds = problem.getLowerBounds();
    const papilo::Vec<papilo::ColFlags>& colFlags = problem.getColFlags();
+   const papilo::ConstraintMatrix<R>& matrix = problem.getConstraintMatrix();
+   const papilo::Vec<papilo::RowFlags>& rowFlags = problem.getRowFlags();
 
-   R switch_sign = lp.spxSense() == SPxLPBase<R>::MAXIMIZE ? -1 : 1;
-
-   for(int col = 0; col < problem.getNCols(); col++)
-   {
-      DSVectorBase<R> emptyVector{0};
-      R lb = lowerBounds[col];
+   R switch_sign = m_thesense == SPxLPBase<R>::MAXIMIZE ? -1 : 1;
 
-      if(colFlags[col].test(papilo::ColFlag::kLbInf))
-         lb = -R(infinity);
+   int ncols = problem.getNCols();
+   int nrows = problem.getNRows();
 
-      R ub = upperBounds[col];
+   data.obj.resize(ncols);
+   data.lower.resize(ncols);
+   data.upper.resize(ncols);
+   data.lhs.resize(nrows);
+   data.rhs.resize(nrows);
+   data.rowStarts.resize(nrows);
+   data.rowLengths.resize(nrows);
+   data.objOffset = objective.offset;
 
-      if(colFlags[col].test(papilo::ColFlag::kUbInf))
-         ub = R(infinity);
+   int nnz = 0;
 
-      LPColBase<R> column(objective.coefficients[col]* switch_sign, emptyVector, ub, lb);
-      lp.addCol(column);
-      assert(lp.lower(col) == lb);
-      assert(lp.upper(col) == ub);
+   for(int row = 0; row < nrows; row++)
+   {
+      data.rowStarts[row] = nnz;
+      data.rowLengths[row] = matrix.getRowCoefficients(row).getLength();
+      nnz += data.rowLengths[row];
    }
 
-   lp.changeObjOffset(objective.offset);
+   data.indices.resize(nnz);
+   data.values.resize(nnz);
+
+   spxParallelForRange(m_threads, ncols, [&](int first, int last)
+   {
+      for(int col = first; col < last; col++)
+      {
+         data.obj[col] = objective.coefficients[col] * switch_sign;
+         data.lower[col] = colFlags[col].test(papilo::ColFlag::kLbInf) ? -R(infinity) : lowerBounds[col];
+         data.upper[col] = colFlags[col].test(papilo::ColFlag::kUbInf) ? R(infinity) : upperBounds[col];
+      }
+   });
 
-   assert(problem.getNCols() == lp.nCols());
+   // collect sides and coefficients of the adjusted constraints
+   spxParallelForRange(m_threads, nrows, [&](int first, int last)
+   {
+      for(int row = first; row < last; row++)
+      {
+         data.rhs[row] = rowFlags[row].test(papilo::RowFlag::kRhsInf) ? R(infinity) :
+                         matrix.getRightHandSides()[row];
+         data.lhs[row] = rowFlags[row].test(papilo::RowFlag::kLhsInf) ? -R(infinity) :
+                         matrix.getLeftHandSides()[row];
+
+         const papilo::SparseVectorView<R> papiloRowVector = matrix.getRowCoefficients(row);
+         std::copy(papiloRowVector.getIndices(), papiloRowVector.getIndices() + data.rowLengths[row],
+                   data.indices.begin() + data.rowStarts[row]);
+         std::copy(papiloRowVector.getValues(), papiloRowVector.getValues() + data.rowLengths[row],
+                   data.values.begin() + data.rowStarts[row]);
+      }
+   });
 }
 
 template<class R>
-void Presol<R>::applyPresolveResultsToRows(SPxLPBase <R>& lp, const papilo::Problem<R>& problem,
-      const papilo::PresolveResult<R>& res) const
+void Presol<R>::loadLP(SPxLPBase<R>& lp, const LPData& data) const
 {
-   int size = res.postsolve.origrow_mapping.size();
-
-   //add the adjusted constraints
-   for(int row = 0; row < size; row++)
-   {
-      R rhs = problem.getConstraintMatrix().getRightHandSides()[row];
+   assert(lp.nRows() == 0);
+   assert(lp.nCols() == 0);
 
-      if(problem.getRowFlags()[row].test(papilo::RowFlag::kRhsInf))
-         rhs = R(infinity);
+   int ncols = (int) data.obj.size();
+   int nrows = (int) data.lhs.size();
+   int nnz = (int) data.values.size();
 
-      R lhs = problem.getConstraintMatrix().getLeftHandSides()[row];
+   // the columns are added without nonzeros, these are added together with the rows
+   lp.addCols(data.obj.data(), data.lower.data(), (R*)0, (int*)0, (int*)0, (int*)0, ncols, 0,
+              data.upper.data());
 
-      if(problem.getRowFlags()[row].test(papilo::RowFlag::kLhsInf))
-         lhs = -R(infinity);
+   // add all rows at once, which also fills the column file in a single pass
+   lp.addRows(data.lhs.data(), data.values.data(), data.indices.data(), data.rowStarts.data(),
+              data.rowLengths.data(), nrows, nnz, data.rhs.data());
 
-      const papilo::SparseVectorView<R> papiloRowVector =
-         problem.getConstraintMatrix().getRowCoefficients(row);
-      const int* indices = papiloRowVector.getIndices();
-      const R* values = papiloRowVector.getValues();
-
-      int length = papiloRowVector.getLength();
-      DSVectorBase<R> soplexRowVector{length};
-
-      for(int i = 0; i < length; i++)
-      {
-         soplexRowVector.add(indices[i], values[i]);
-      }
-
-      LPRowBase<R> lpRowBase(lhs, soplexRowVector, rhs);
-      lp.addRow(lpRowBase);
-      assert(lp.lhs(row) == lhs);
-      assert(lp.rhs(row) == rhs);
-   }
+   lp.changeObjOffset(data.objOffset);
 
-   assert(problem.getNRows() == lp.nRows());
+   assert(lp.nCols() == ncols);
+   assert(lp.nRows() == nrows);
 }
 
 } // namespace soplex
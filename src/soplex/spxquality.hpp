@@ -34,158 +34,147 @@ namespace soplex
 template <class R>
 void SPxSolverBase<R>::qualConstraintViolation(R& maxviol, R& sumviol) const
 {
-   maxviol = 0.0;
-   sumviol = 0.0;
-
    VectorBase<R> solu(this->nCols());
 
    getPrimalSol(solu);
 
-   for(int row = 0; row < this->nRows(); ++row)
+   spxParallelViolation(this->threads(), this->nRows(), maxviol, sumviol,
+                        [&](int first, int last, R & blockmax, R & blocksum)
    {
-      const SVectorBase<R>& rowvec = this->rowVector(row);
+      for(int row = first; row < last; ++row)
+      {
+         const SVectorBase<R>& rowvec = this->rowVector(row);
 
-      R val = 0.0;
+         R val = 0.0;
 
-      for(int col = 0; col < rowvec.size(); ++col)
-         val += rowvec.value(col) * solu[rowvec.index(col)];
+         for(int col = 0; col < rowvec.size(); ++col)
+            val += rowvec.value(col) * solu[rowvec.index(col)];
 
-      R viol = 0.0;
+         R viol = 0.0;
 
-      assert(this->lhs(row) <= this->rhs(row) + 1e-9);
+         assert(this->lhs(row) <= this->rhs(row) + 1e-9);
 
-      if(val < this->lhs(row))
-         viol = spxAbs(val - this->lhs(row));
-      else if(val > this->rhs(row))
-         viol = spxAbs(val - this->rhs(row));
+         if(val < this->lhs(row))
+            viol = spxAbs(val - this->lhs(row));
+         else if(val > this->rhs(row))
+            viol = spxAbs(val - this->rhs(row));
 
-      if(viol > maxviol)
-         maxviol = viol;
+         if(viol > blockmax)
+            blockmax = viol;
 
-      sumviol += viol;
-   }
+         blocksum += viol;
+      }
+   });
 }
 
 template <class R>
 void SPxSolverBase<R>::qualBoundViolation(
    R& maxviol, R& sumviol) const
 {
-   maxviol = 0.0;
-   sumviol = 0.0;
-
    VectorBase<R> solu(this->nCols());
 
    getPrimalSol(solu);
 
-   for(int col = 0; col < this->nCols(); ++col)
+   spxParallelViolation(this->threads(), this->nCols(), maxviol, sumviol,
+                        [&](int first, int last, R & blockmax, R & blocksum)
    {
-      assert(this->lower(col) <= this->upper(col) + 1e-9);
+      for(int col = first; col < last; ++col)
+      {
+         assert(this->lower(col) <= this->upper(col) + 1e-9);
 
-      R viol = 0.0;
+         R viol = 0.0;
 
-      if(solu[col] < this->lower(col))
-         viol = spxAbs(solu[col] - this->lower(col));
-      else if(solu[col] > this->upper(col))
-         viol = spxAbs(solu[col] - this->upper(col));
+         if(solu[col] < this->lower(col))
+            viol = spxAbs(solu[col] - this->lower(col));
+         else if(solu[col] > this->upper(col))
+            viol = spxAbs(solu[col] - this->upper(col));
 
-      if(viol > maxviol)
-         maxviol = viol;
+         if(viol > blockmax)
+            blockmax = viol;
 
-      sumviol += viol;
-   }
+         blocksum += viol;
+      }
+   });
 }
 
 template <class R>
 void SPxSolverBase<R>::qualSlackViolation(R& maxviol, R& sumviol) const
 {
-   maxviol = 0.0;
-   sumviol = 0.0;
-
    VectorBase<R> solu(this->nCols());
    VectorBase<R> slacks(this->nRows());
 
    getPrimalSol(solu);
    getSlacks(slacks);
 
-   for(int row = 0; row < this->nRows(); ++row)
+   spxParallelViolation(this->threads(), this->nRows(), maxviol, sumviol,
+                        [&](int first, int last, R & blockmax, R & blocksum)
    {
-      const SVectorBase<R>& rowvec = this->rowVector(row);
+      for(int row = first; row < last; ++row)
+      {
+         const SVectorBase<R>& rowvec = this->rowVector(row);
 
-      R val = 0.0;
+         R val = 0.0;
 
-      for(int col = 0; col < rowvec.size(); ++col)
-         val += rowvec.value(col) * solu[rowvec.index(col)];
+         for(int col = 0; col < rowvec.size(); ++col)
+            val += rowvec.value(col) * solu[rowvec.index(col)];
 
-      R viol = spxAbs(val - slacks[row]);
+         R viol = spxAbs(val - slacks[row]);
 
-      if(viol > maxviol)
-         maxviol = viol;
+         if(viol > blockmax)
+            blockmax = viol;
 
-      sumviol += viol;
-   }
+         blocksum += viol;
+      }
+   });
 }
 
 template <class R>
 void SPxSolverBase<R>::qualRedCostViolation(R& maxviol, R& sumviol) const
 {
-   maxviol = 0.0;
-   sumviol = 0.0;
-
-   int i;
-
    // TODO:   y = c_B * B^-1  => coSolve(y, c_B)
    //         redcost = c_N - yA_N
    // solve system "x = e_i^T * B^-1" to get i'th row of B^-1
    // VectorBase<R> y( this->nRows() );
    // basis().coSolve( x, spx->unitVector( i ) );
    // VectorBase<R> rdcost( this->nCols() );
-   if(type() == ENTER)
+
+   // collects the violations of the negative entries of a test vector
+   auto testViolation = [&](const VectorBase<R>& testvec, R & testmax, R & testsum)
    {
-      for(i = 0; i < dim(); ++i)
+      spxParallelViolation(this->threads(), testvec.dim(), testmax, testsum,
+                           [&](int first, int last, R & blockmax, R & blocksum)
       {
-         R x = coTest()[i];
-
-         if(x < 0.0)
+         for(int i = first; i < last; ++i)
          {
-            sumviol -= x;
+            R x = testvec[i];
 
-            if(x < maxviol)
-               maxviol = x;
-         }
-      }
+            if(x < 0.0)
+            {
+               blocksum -= x;
 
-      for(i = 0; i < coDim(); ++i)
-      {
-         R x = test()[i];
+               if(-x > blockmax)
+                  blockmax = -x;
+            }
+         }
+      });
+   };
 
-         if(x < 0.0)
-         {
-            sumviol -= x;
+   testViolation(type() == ENTER ? coTest() : fTest(), maxviol, sumviol);
 
-            if(x < maxviol)
-               maxviol = x;
-         }
-      }
-   }
-   else
+   if(type() == ENTER)
    {
-      assert(type() == LEAVE);
+      R testmax;
+      R testsum;
 
-      for(i = 0; i < dim(); ++i)
-      {
-         R x = fTest()[i];
+      testViolation(test(), testmax, testsum);
 
-         if(x < 0.0)
-         {
-            sumviol -= x;
+      if(testmax > maxviol)
+         maxviol = testmax;
 
-            if(x < maxviol)
-               maxviol = x;
-         }
-      }
+      sumviol += testsum;
    }
-
-   maxviol *= -1;
+   else
+      assert(type() == LEAVE);
 }
 
 } // namespace soplex
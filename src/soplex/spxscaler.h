@@ -117,6 +117,10 @@ public:
    /// applies m_colscale and m_rowscale to the \p lp.
    virtual void applyScaling(SPxLPBase<R>& lp);
 
+   /// scales the \p lp with the given scaling exponents, e.g., to restore the scaling of an earlier solve
+   virtual void restoreScaling(SPxLPBase<R>& lp, const std::vector<int>& rowScaleExp,
+                               const std::vector<int>& colScaleExp);
+
 
    template <class T>
    friend std::ostream& operator<<(std::ostream& s, const SPxScaler<T>& sc);
@@ -249,6 +249,25 @@ void SPxScaler<R>::applyScaling(SPxLPBase<R>& lp)
    assert(lp.isConsistent());
 }
 
+/// scales the LP with the given scaling exponents
+template <class R>
+void SPxScaler<R>::restoreScaling(SPxLPBase<R>& lp, const std::vector<int>& rowScaleExp,
+                                  const std::vector<int>& colScaleExp)
+{
+   assert(int(rowScaleExp.size()) == lp.nRows());
+   assert(int(colScaleExp.size()) == lp.nCols());
+
+   setup(lp);
+
+   for(int i = 0; i < lp.nRows(); ++i)
+      (*m_activeRowscaleExp)[i] = rowScaleExp[i];
+
+   for(int i = 0; i < lp.nCols(); ++i)
+      (*m_activeColscaleExp)[i] = colScaleExp[i];
+
+   applyScaling(lp);
+}
+
 /// unscale SPxLP
 template <class R>
 void SPxScaler<R>::unscale(SPxLPBase<R>& lp)
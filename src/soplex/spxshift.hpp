@@ -23,7 +23,10 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 #include <assert.h>
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <vector>
 
 #include "soplex/spxdefines.h"
 #include "soplex/spxsolver.h"
@@ -200,12 +203,14 @@ void SPxSolverBase<R>::perturbMin(
          {
             p_up[i] = x + random.next((double) minrandom, (double)maxrandom);
             theShift += p_up[i] - u;
+            markShifted(p_up, i);
          }
 
          if(GT(l, R(-infinity)) && NE(l, u) && l >= x - eps)
          {
             p_low[i] = x - random.next((double)minrandom, (double)maxrandom);
             theShift -= p_low[i] - l;
+            markShifted(p_low, i);
          }
       }
    }
@@ -233,6 +238,7 @@ void SPxSolverBase<R>::perturbMin(
             {
                p_up[i] = vec[i] + random.next((double)minrandom, (double)maxrandom);
                theShift += p_up[i] - u;
+               markShifted(p_up, i);
             }
          }
          else if(x > eps)
@@ -241,6 +247,7 @@ void SPxSolverBase<R>::perturbMin(
             {
                p_low[i] = vec[i] - random.next((double)minrandom, (double)maxrandom);
                theShift -= p_low[i] - l;
+               markShifted(p_low, i);
             }
          }
       }
@@ -280,12 +287,14 @@ void SPxSolverBase<R>::perturbMax(
          {
             p_up[i] = x + random.next((double)minrandom, (double)maxrandom);
             theShift += p_up[i] - u;
+            markShifted(p_up, i);
          }
 
          if(GT(l, R(-infinity)) && NE(l, u) && l >= x - eps)
          {
             p_low[i] = x - random.next((double)minrandom, (double)maxrandom);
             theShift -= p_low[i] - l;
+            markShifted(p_low, i);
          }
       }
    }
@@ -313,6 +322,7 @@ void SPxSolverBase<R>::perturbMax(
             {
                p_up[i] = vec[i] + random.next((double)minrandom, (double)maxrandom);
                theShift += p_up[i] - u;
+               markShifted(p_up, i);
             }
          }
          else if(x < -eps)
@@ -321,6 +331,7 @@ void SPxSolverBase<R>::perturbMax(
             {
                p_low[i] = vec[i] - random.next((double)minrandom, (double)maxrandom);
                theShift -= p_low[i] - l;
+               markShifted(p_low, i);
             }
          }
       }
@@ -382,12 +393,14 @@ R SPxSolverBase<R>::perturbMin(
          {
             p_up[i] = vec[i] + random.next((double)minrandom, (double)maxrandom);
             l_theShift += p_up[i] - u;
+            markShifted(p_up, i);
          }
 
          if(GT(l, R(-infinity)) && NE(l, u) && l >= x - eps && rep() * stat[i] < 0)
          {
             p_low[i] = vec[i] - random.next((double)minrandom, (double)maxrandom);
             l_theShift -= p_low[i] - l;
+            markShifted(p_low, i);
          }
       }
    }
@@ -409,6 +422,7 @@ R SPxSolverBase<R>::perturbMin(
             {
                p_up[i] = vec[i] + random.next((double)minrandom, (double)maxrandom);
                l_theShift += p_up[i] - u;
+               markShifted(p_up, i);
             }
          }
          else if(x > eps)
@@ -417,6 +431,7 @@ R SPxSolverBase<R>::perturbMin(
             {
                p_low[i] = vec[i] - random.next((double)minrandom, (double)maxrandom);
                l_theShift -= p_low[i] - l;
+               markShifted(p_low, i);
             }
          }
       }
@@ -460,12 +475,14 @@ R SPxSolverBase<R>::perturbMax(
          {
             p_up[i] = vec[i] + random.next((double)minrandom, (double)maxrandom);
             l_theShift += p_up[i] - u;
+            markShifted(p_up, i);
          }
 
          if(GT(l, R(-infinity)) && NE(l, u) && l >= x - eps && rep() * stat[i] < 0)
          {
             p_low[i] = vec[i] - random.next((double)minrandom, (double)maxrandom);
             l_theShift -= p_low[i] - l;
+            markShifted(p_low, i);
          }
       }
    }
@@ -487,6 +504,7 @@ R SPxSolverBase<R>::perturbMax(
             {
                p_up[i] = vec[i] + random.next((double)minrandom, (double)maxrandom);
                l_theShift += p_up[i] - u;
+               markShifted(p_up, i);
             }
          }
          else if(x < -eps)
@@ -495,6 +513,7 @@ R SPxSolverBase<R>::perturbMax(
             {
                p_low[i] = vec[i] - random.next((double)minrandom, (double)maxrandom);
                l_theShift -= p_low[i] - l;
+               markShifted(p_low, i);
             }
          }
       }
@@ -532,17 +551,55 @@ void SPxSolverBase<R>::perturbMaxLeave(void)
 }
 
 
+/* In the entering algorithm, the bounds of the leaving variable are copied from its basis position to its row or column
+ * and the bounds of the entering variable from its row or column to the basis position.
+ */
+template <class R>
+void SPxSolverBase<R>::moveShifted(int leaveIdx, const SPxId& enterId)
+{
+   SPxId leaveId = this->baseId(leaveIdx);
+
+   if(shiftedBasic.contains(leaveIdx))
+   {
+      if(leaveId.isSPxRowId())
+         shiftedRows.add(this->number(SPxRowId(leaveId)));
+      else
+         shiftedCols.add(this->number(SPxColId(leaveId)));
+   }
+
+   if(enterId.isSPxRowId() ? shiftedRows.contains(this->number(SPxRowId(enterId)))
+         : shiftedCols.contains(this->number(SPxColId(enterId))))
+      shiftedBasic.add(leaveIdx);
+}
+
 template <class R>
 void SPxSolverBase<R>::unShift(void)
 {
    MSG_INFO3((*this->spxout), (*this->spxout) << "DSHIFT07 = " << "unshifting ..." << std::endl;);
 
+   unShiftTime->start();
+   ++unShiftCount;
+
    if(isInitialized())
    {
       int i;
       R t_up, t_low;
       const typename SPxBasisBase<R>::Desc& ds = this->desc();
 
+      // only shifted bounds may differ from their original values; visiting them in decreasing order sums up the
+      // remaining shift in the same order as a pass over all indices
+      std::sort(shiftedBasic.idx.begin(), shiftedBasic.idx.end(), std::greater<int>());
+      std::sort(shiftedRows.idx.begin(), shiftedRows.idx.end(), std::greater<int>());
+      std::sort(shiftedCols.idx.begin(), shiftedCols.idx.end(), std::greater<int>());
+
+      const std::vector<int>& basicIdx = shiftedBasic.idx;
+      const std::vector<int>& rowIdx = shiftedRows.idx;
+      const std::vector<int>& colIdx = shiftedCols.idx;
+
+      assert(basicIdx.empty() || basicIdx[0] < dim());
+      assert(rowIdx.empty() || rowIdx[0] < this->nRows());
+      assert(colIdx.empty() || colIdx[0] < this->nCols());
+
       theShift = 0;
 
       if(type() == ENTER)
@@ -551,8 +608,9 @@ void SPxSolverBase<R>::unShift(void)
 
          if(rep() == COLUMN)
          {
-            for(i = dim(); i-- > 0;)
+            for(int k = 0; k < int(basicIdx.size()); ++k)
             {
+               i = basicIdx[k];
                SPxId l_id = this->baseId(i);
                int l_num = this->number(l_id);
 
@@ -589,8 +647,9 @@ void SPxSolverBase<R>::unShift(void)
                }
             }
 
-            for(i = this->nRows(); i-- > 0;)
+            for(int k = 0; k < int(rowIdx.size()); ++k)
             {
+               i = rowIdx[k];
                if(!isBasic(ds.rowStatus(i)))
                {
                   t_up = -this->lhs(i);
@@ -604,8 +663,9 @@ void SPxSolverBase<R>::unShift(void)
                }
             }
 
-            for(i = this->nCols(); i-- > 0;)
+            for(int k = 0; k < int(colIdx.size()); ++k)
             {
+               i = colIdx[k];
                if(!isBasic(ds.colStatus(i)))
                {
                   t_up = this->upper(i);
@@ -623,8 +683,9 @@ void SPxSolverBase<R>::unShift(void)
          {
             assert(rep() == ROW);
 
-            for(i = dim(); i-- > 0;)
+            for(int k = 0; k < int(basicIdx.size()); ++k)
             {
+               i = basicIdx[k];
                SPxId l_id = this->baseId(i);
                int l_num = this->number(l_id);
                t_up = t_low = 0;
@@ -661,8 +722,9 @@ void SPxSolverBase<R>::unShift(void)
                }
             }
 
-            for(i = this->nRows(); i-- > 0;)
+            for(int k = 0; k < int(rowIdx.size()); ++k)
             {
+               i = rowIdx[k];
                if(!isBasic(ds.rowStatus(i)))
                {
                   t_up = t_low = 0;
@@ -676,8 +738,9 @@ void SPxSolverBase<R>::unShift(void)
                }
             }
 
-            for(i = this->nCols(); i-- > 0;)
+            for(int k = 0; k < int(colIdx.size()); ++k)
             {
+               i = colIdx[k];
                if(!isBasic(ds.colStatus(i)))
                {
                   t_up = t_low = 0;
@@ -700,8 +763,9 @@ void SPxSolverBase<R>::unShift(void)
 
          if(rep() == COLUMN)
          {
-            for(i = this->nRows(); i-- > 0;)
+            for(int k = 0; k < int(rowIdx.size()); ++k)
             {
+               i = rowIdx[k];
                t_up = t_low = this->maxRowObj(i);
                clearDualBounds(ds.rowStatus(i), t_up, t_low);
 
@@ -733,8 +797,9 @@ void SPxSolverBase<R>::unShift(void)
                   theShift += t_low - theLRbound[i];
             }
 
-            for(i = this->nCols(); i-- > 0;)
+            for(int k = 0; k < int(colIdx.size()); ++k)
             {
+               i = colIdx[k];
                t_up = t_low = -this->maxObj(i);
                clearDualBounds(ds.colStatus(i), t_low, t_up);
 
@@ -770,8 +835,9 @@ void SPxSolverBase<R>::unShift(void)
          {
             assert(rep() == ROW);
 
-            for(i = this->nRows(); i-- > 0;)
+            for(int k = 0; k < int(rowIdx.size()); ++k)
             {
+               i = rowIdx[k];
                t_up = this->rhs(i);
                t_low = this->lhs(i);
 
@@ -800,8 +866,9 @@ void SPxSolverBase<R>::unShift(void)
                   theShift += t_low - theLRbound[i];
             }
 
-            for(i = this->nCols(); i-- > 0;)
+            for(int k = 0; k < int(colIdx.size()); ++k)
             {
+               i = colIdx[k];
                t_up = this->upper(i);
                t_low = this->lower(i);
 
@@ -832,5 +899,7 @@ void SPxSolverBase<R>::unShift(void)
          }
       }
    }
+
+   unShiftTime->stop();
 }
 } // namespace soplex
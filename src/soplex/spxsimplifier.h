@@ -248,6 +248,12 @@ public:
       m_minReduction = minRed;
    }
 
+   /// estimated peak number of bytes of matrix data held during the last simplification, 0 if not tracked
+   virtual size_t peakMemory() const
+   {
+      return 0;
+   }
+
    ///@}
 
    //-------------------------------------
@@ -192,6 +192,16 @@ typename SPxSolverBase<R>::Status SPxSolverBase<R>::solve(volatile bool* interru
    this->lastIterCount = 0;
    this->iterDegenCheck = 0;
 
+   shiftCount = 0;
+   unShiftCount = 0;
+   cleanupStart = -1;
+   unShiftTime->reset();
+
+   checkpointWriter.start();
+
+   if(hasResumeData)
+      resumeCheckpointBasis();
+
    if(!isInitialized())
    {
       /*
@@ -212,6 +222,7 @@ typename SPxSolverBase<R>::Status SPxSolverBase<R>::solve(volatile bool* interru
       {
          assert(SPxBasisBase<R>::status() == SPxBasisBase<R>::SINGULAR);
          m_status = UNKNOWN;
+         hasResumeData = false;
          return status();
       }
    }
@@ -226,6 +237,10 @@ typename SPxSolverBase<R>::Status SPxSolverBase<R>::solve(volatile bool* interru
    assert(thepricer->solver()      == this);
    assert(theratiotester->solver() == this);
 
+   // the pricer keeps dual norms which are set up at this point
+   if(hasResumeData)
+      resumeCheckpointNorms();
+
    // maybe this should be done in init() ?
    thepricer->setType(type());
    theratiotester->setType(type());
@@ -244,6 +259,8 @@ typename SPxSolverBase<R>::Status SPxSolverBase<R>::solve(volatile bool* interru
    enterCount = 0;
    primalCount = 0;
    polishCount = 0;
+   polishAttempts = 0;
+   polishTime->reset();
    boundflips = 0;
    totalboundflips = 0;
    enterCycles = 0;
@@ -603,6 +620,9 @@ typename SPxSolverBase<R>::Status SPxSolverBase<R>::solve(volatile bool* interru
                   // factorize();
                   unShift();
 
+                  if(cleanupStart < 0)
+                     cleanupStart = this->iteration();
+
                   R maxinfeas = maxInfeas();
 
                   MSG_INFO3((*this->spxout),
@@ -954,6 +974,9 @@ typename SPxSolverBase<R>::Status SPxSolverBase<R>::solve(volatile bool* interru
                   // factorize();
                   unShift();
 
+                  if(cleanupStart < 0)
+                     cleanupStart = this->iteration();
+
                   R maxinfeas = maxInfeas();
 
                   MSG_INFO3((*this->spxout),
@@ -1215,6 +1238,82 @@ typename SPxSolverBase<R>::Status SPxSolverBase<R>::solve(volatile bool* interru
    return status();
 }
 
+template <class R>
+int SPxSolverBase<R>::polishCandidates(DIdxSet& candidates, bool rowCandidates, bool& stop)
+{
+   assert(type() == ENTER || !rowCandidates);
+
+#ifndef NDEBUG
+   // allow a small relative deviation from the original values
+   R alloweddeviation = (type() == ENTER) ? entertol() : leavetol();
+   R origval = value();
+   R origshift = shift();
+#endif
+
+   int nSuccessfulPivots = 0;
+   int nFailedPivots = 0;
+   int pos = candidates.size() - 1;
+
+   // the candidates are scanned cyclically; since only successful pivots change the basis, the scan terminates as soon
+   // as every remaining candidate failed once after the last successful pivot
+   while(!stop && nFailedPivots < candidates.size())
+   {
+      if(pos < 0)
+         pos = candidates.size() - 1;
+
+      bool success;
+
+      if(type() == ENTER)
+      {
+         SPxId polishId = rowCandidates ? coId(candidates.index(pos)) : id(candidates.index(pos));
+         MSG_DEBUG(std::cout << "try pivoting: " << polishId;)
+         success = enter(polishId, true);
+      }
+      else
+      {
+         MSG_DEBUG(std::cout << "try pivoting: " << this->baseId(candidates.index(pos));)
+         success = leave(candidates.index(pos), true);
+      }
+
+      clearUpdateVecs();
+      ++polishAttempts;
+#ifndef NDEBUG
+      assert(EQrel(value(), origval, alloweddeviation));
+      assert(LErel(shift(), origshift, alloweddeviation));
+#endif
+
+      if(success)
+      {
+         MSG_DEBUG(std::cout << " -> success!";)
+         ++nSuccessfulPivots;
+         nFailedPivots = 0;
+         candidates.remove(pos);
+
+         if(maxIters >= 0 && iterations() >= maxIters)
+            stop = true;
+      }
+      else
+         ++nFailedPivots;
+
+      MSG_DEBUG(std::cout << std::endl;)
+
+      --pos;
+
+      if(polishLimit >= 0 && polishAttempts >= polishLimit)
+      {
+         MSG_INFO2((*this->spxout), (*this->spxout) << " --- solution polishing limit reached" << std::endl;)
+         stop = true;
+      }
+
+      if(isTimeLimitReached())
+         stop = true;
+   }
+
+   polishCount += nSuccessfulPivots;
+
+   return nSuccessfulPivots;
+}
+
 template <class R>
 void SPxSolverBase<R>::performSolutionPolishing()
 {
@@ -1225,26 +1324,22 @@ void SPxSolverBase<R>::performSolutionPolishing()
    if(stop || polishObj == POLISH_OFF || status() != OPTIMAL)
       return;
 
-   int nSuccessfulPivots;
+   polishTime->start();
+
    const typename SPxBasisBase<R>::Desc& ds = this->desc();
    const typename SPxBasisBase<R>::Desc::Status* rowstatus = ds.rowStatus();
    const typename SPxBasisBase<R>::Desc::Status* colstatus = ds.colStatus();
    typename SPxBasisBase<R>::Desc::Status stat;
    SPxId polishId;
-   bool success = false;
 
    MSG_INFO2((*this->spxout), (*this->spxout) << " --- perform solution polishing" << std::endl;)
 
+   // the candidate sets are computed once; pivots with zero reduced costs or zero basic values do not change the dual
+   // or primal solution, hence the only update needed after a successful pivot is to remove the pivoted candidate
    if(rep() == COLUMN)
    {
       setType(ENTER); // use primal simplex to preserve feasibility
       init();
-#ifndef NDEBUG
-      // allow a small relative deviation from the original values
-      R alloweddeviation = entertol();
-      R origval = value();
-      R origshift = shift();
-#endif
       instableEnter = false;
       theratiotester->setType(type());
 
@@ -1285,69 +1380,18 @@ void SPxSolverBase<R>::performSolutionPolishing()
             }
          }
 
+         // alternate between both candidate sets as long as pivots of the one set may enable pivots of the other
+         bool firstRound = true;
+
          while(!stop)
          {
-            nSuccessfulPivots = 0;
+            if(polishCandidates(slackcandidates, true, stop) == 0 && !firstRound)
+               break;
 
-            // identify nonbasic slack variables, i.e. rows, that may be moved into the basis
-            for(int i = slackcandidates.size() - 1; i >= 0 && !stop; --i)
-            {
-               polishId = coId(slackcandidates.index(i));
-               MSG_DEBUG(std::cout << "try pivoting: " << polishId << " stat: " << rowstatus[slackcandidates.index(
-                            i)];)
-               success = enter(polishId, true);
-               clearUpdateVecs();
-#ifndef NDEBUG
-               assert(EQrel(value(), origval, alloweddeviation));
-               assert(LErel(shift(), origshift, alloweddeviation));
-#endif
-
-               if(success)
-               {
-                  MSG_DEBUG(std::cout << " -> success!";)
-                  ++nSuccessfulPivots;
-                  slackcandidates.remove(i);
-
-                  if(maxIters >= 0 && iterations() >= maxIters)
-                     stop = true;
-               }
-
-               MSG_DEBUG(std::cout << std::endl;)
-
-               if(isTimeLimitReached())
-                  stop = true;
-            }
-
-            // identify nonbasic variables that may be moved into the basis
-            for(int i = continuousvars.size() - 1; i >= 0 && !stop; --i)
-            {
-               polishId = id(continuousvars.index(i));
-               MSG_DEBUG(std::cout << "try pivoting: " << polishId << " stat: " << colstatus[continuousvars.index(
-                            i)];)
-               success = enter(polishId, true);
-               clearUpdateVecs();
-
-               if(success)
-               {
-                  MSG_DEBUG(std::cout << " -> success!";)
-                  ++nSuccessfulPivots;
-                  continuousvars.remove(i);
-
-                  if(maxIters >= 0 && iterations() >= maxIters)
-                     stop = true;
-               }
-
-               MSG_DEBUG(std::cout << std::endl;)
-
-               if(isTimeLimitReached())
-                  stop = true;
-            }
+            if(polishCandidates(continuousvars, false, stop) == 0)
+               break;
 
-            // terminate if in the last round no more polishing steps were performed
-            if(nSuccessfulPivots == 0)
-               stop = true;
-
-            polishCount += nSuccessfulPivots;
+            firstRound = false;
          }
       }
       else
@@ -1356,7 +1400,7 @@ void SPxSolverBase<R>::performSolutionPolishing()
          DIdxSet candidates(dim());
 
          // identify nonbasic variables, i.e. columns, that may be moved into the basis
-         for(int i = 0; i < this->nCols() && !stop; ++i)
+         for(int i = 0; i < this->nCols(); ++i)
          {
             if(colstatus[i] == SPxBasisBase<R>::Desc::P_ON_LOWER
                   || colstatus[i] == SPxBasisBase<R>::Desc::P_ON_UPPER)
@@ -1367,55 +1411,13 @@ void SPxSolverBase<R>::performSolutionPolishing()
             }
          }
 
-         while(!stop)
-         {
-            nSuccessfulPivots = 0;
-
-            for(int i = candidates.size() - 1; i >= 0 && !stop; --i)
-            {
-               polishId = id(candidates.index(i));
-               MSG_DEBUG(std::cout << "try pivoting: " << polishId << " stat: " << colstatus[candidates.index(i)];)
-               success = enter(polishId, true);
-               clearUpdateVecs();
-#ifndef NDEBUG
-               assert(EQrel(value(), origval, alloweddeviation));
-               assert(LErel(shift(), origshift, alloweddeviation));
-#endif
-
-               if(success)
-               {
-                  MSG_DEBUG(std::cout << " -> success!";)
-                  ++nSuccessfulPivots;
-                  candidates.remove(i);
-
-                  if(maxIters >= 0 && iterations() >= maxIters)
-                     stop = true;
-               }
-
-               MSG_DEBUG(std::cout << std::endl;)
-
-               if(isTimeLimitReached())
-                  stop = true;
-            }
-
-            // terminate if in the last round no more polishing steps were performed
-            if(nSuccessfulPivots == 0)
-               stop = true;
-
-            polishCount += nSuccessfulPivots;
-         }
+         polishCandidates(candidates, false, stop);
       }
    }
    else
    {
       setType(LEAVE); // use primal simplex to preserve feasibility
       init();
-#ifndef NDEBUG
-      // allow a small relative deviation from the original values
-      R alloweddeviation = leavetol();
-      R origval = value();
-      R origshift = shift();
-#endif
       instableLeave = false;
       theratiotester->setType(type());
       bool useIntegrality = false;
@@ -1424,11 +1426,11 @@ void SPxSolverBase<R>::performSolutionPolishing()
       if(integerVariables.size() == ncols)
          useIntegrality = true;
 
+      DIdxSet basiccandidates(dim());
+
       // in ROW rep: pivot slack out of the basis
       if(polishObj == POLISH_INTEGRALITY)
       {
-         DIdxSet basiccandidates(dim());
-
          // collect basic candidates that may be moved out of the basis
          for(int i = 0; i < dim(); ++i)
          {
@@ -1451,49 +1453,10 @@ void SPxSolverBase<R>::performSolutionPolishing()
                   basiccandidates.addIdx(i);
             }
          }
-
-         while(!stop)
-         {
-            nSuccessfulPivots = 0;
-
-            for(int i = basiccandidates.size() - 1; i >= 0 && !stop; --i)
-            {
-
-               MSG_DEBUG(std::cout << "try pivoting: " << this->baseId(basiccandidates.index(i));)
-               success = leave(basiccandidates.index(i), true);
-               clearUpdateVecs();
-#ifndef NDEBUG
-               assert(EQrel(value(), origval, alloweddeviation));
-               assert(LErel(shift(), origshift, alloweddeviation));
-#endif
-
-               if(success)
-               {
-                  MSG_DEBUG(std::cout << " -> success!";)
-                  ++nSuccessfulPivots;
-                  basiccandidates.remove(i);
-
-                  if(maxIters >= 0 && iterations() >= maxIters)
-                     stop = true;
-               }
-
-               MSG_DEBUG(std::cout << std::endl;)
-
-               if(isTimeLimitReached())
-                  stop = true;
-            }
-
-            // terminate if in the last round no more polishing steps were performed
-            if(nSuccessfulPivots == 0)
-               stop = true;
-
-            polishCount += nSuccessfulPivots;
-         }
       }
       else
       {
          assert(polishObj == POLISH_FRACTIONALITY);
-         DIdxSet basiccandidates(dim());
 
          // collect basic (integer) variables, that may be moved out of the basis
          for(int i = 0; i < dim(); ++i)
@@ -1516,48 +1479,16 @@ void SPxSolverBase<R>::performSolutionPolishing()
                   basiccandidates.addIdx(i);
             }
          }
-
-         while(!stop)
-         {
-            nSuccessfulPivots = 0;
-
-            for(int i = basiccandidates.size() - 1; i >= 0 && !stop; --i)
-            {
-               MSG_DEBUG(std::cout << "try pivoting: " << this->baseId(basiccandidates.index(i));)
-               success = leave(basiccandidates.index(i), true);
-               clearUpdateVecs();
-#ifndef NDEBUG
-               assert(EQrel(value(), origval, alloweddeviation));
-               assert(LErel(shift(), origshift, alloweddeviation));
-#endif
-
-               if(success)
-               {
-                  MSG_DEBUG(std::cout << " -> success!";)
-                  ++nSuccessfulPivots;
-                  basiccandidates.remove(i);
-
-                  if(maxIters >= 0 && iterations() >= maxIters)
-                     stop = true;
-               }
-
-               MSG_DEBUG(std::cout << std::endl;)
-
-               if(isTimeLimitReached())
-                  stop = true;
-            }
-
-            // terminate if in the last round no more polishing steps were performed
-            if(nSuccessfulPivots == 0)
-               stop = true;
-
-            polishCount += nSuccessfulPivots;
-         }
       }
+
+      polishCandidates(basiccandidates, false, stop);
    }
 
+   polishTime->stop();
+
    MSG_INFO1((*this->spxout),
-             (*this->spxout) << " --- finished solution polishing (" << polishCount << " pivots)" << std::endl;)
+             (*this->spxout) << " --- finished solution polishing (" << polishCount << " pivots, "
+             << polishAttempts << " candidates tried)" << std::endl;)
 
    this->setStatus(SPxBasisBase<R>::OPTIMAL);
 }
@@ -1684,6 +1615,9 @@ void SPxSolverBase<R>::printDisplayLine(const bool force, const bool forceHead)
          (*this->spxout) << " | " << std::scientific << std::setprecision(2) <<
                          basis().getEstimatedCondition();
 
+      if(printBasisMetric == 4)
+         (*this->spxout) << " | " << std::scientific << std::setprecision(2) << getBasisMetric(3);
+
       (*this->spxout) << std::endl;
    }
    displayLine++;
@@ -1757,6 +1691,9 @@ bool SPxSolverBase<R>::terminate()
          unShift();
    }
 
+   if(checkpointWriter.isDue(this->iteration()) && SPxBasisBase<R>::status() > SPxBasisBase<R>::SINGULAR)
+      writeCheckpoint();
+
    // check time limit and objective limit only for non-terminal bases
    if(SPxBasisBase<R>::status() >= SPxBasisBase<R>::OPTIMAL  ||
          SPxBasisBase<R>::status() <= SPxBasisBase<R>::SINGULAR)
@@ -32,6 +32,7 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 #include "soplex/spxdefines.h"
 #include "soplex/timer.h"
@@ -45,6 +46,7 @@
 #include "soplex/stablesum.h"
 
 #include "soplex/spxlpbase.h"
+#include "soplex/spxcheckpoint.h"
 
 #define HYPERPRICINGTHRESHOLD    5000     /**< do (auto) hyper pricing only if problem size (cols+rows) is larger than HYPERPRICINGTHRESHOLD */
 #define HYPERPRICINGSIZE         100      /**< size of initial candidate list for hyper pricing */
@@ -262,6 +264,7 @@ private:
    Pricing        thePricing;  ///< full or partial pricing.
    Representation theRep;      ///< row or column representation.
    SolutionPolish polishObj;   ///< objective of solution polishing
+   int            polishLimit; ///< maximum number of candidates tried during solution polishing (-1: no limit)
    Timer*         theTime;     ///< time spent in last call to method solve()
    Timer::TYPE    timerType;   ///< type of timer (user or wallclock)
    Real           theCumulativeTime; ///< cumulative time spent in all calls to method solve()
@@ -287,6 +290,66 @@ private:
    R           m_leavetol;    ///< feasibility tolerance maintained during leaving algorithm
    R           theShift;      ///< sum of all shifts applied to any bound.
    R           lastShift;     ///< for forcing feasibility.
+
+   /// indices of the shifted entries of a pair of bound vectors
+   struct ShiftSet
+   {
+      std::vector<int> idx;         ///< shifted indices, each stored once
+      std::vector<bool> isShifted;  ///< is the index contained in \p idx?
+
+      /// adds index \p i
+      void add(int i)
+      {
+         assert(i >= 0);
+
+         if(i >= int(isShifted.size()))
+            isShifted.resize(i + 1, false);
+
+         if(!isShifted[i])
+         {
+            isShifted[i] = true;
+            idx.push_back(i);
+         }
+      }
+
+      /// is index \p i contained?
+      bool contains(int i) const
+      {
+         return i < int(isShifted.size()) && isShifted[i];
+      }
+
+      /// removes all indices
+      void clear()
+      {
+         for(int i : idx)
+            isShifted[i] = false;
+
+         idx.clear();
+      }
+   };
+
+   /** Every shifted bound is recorded in one of the following sets, which are emptied whenever the bounds are set up
+    *  from scratch. Shifted bounds of basic variables move with the variable between the basis positions and the rows
+    *  and columns. Hence, unShift() only needs to visit the indices in these sets.
+    */
+   ShiftSet       shiftedBasic;  ///< shifted entries of theUBbound and theLBbound
+   ShiftSet       shiftedRows;   ///< shifted entries of theURbound and theLRbound
+   ShiftSet       shiftedCols;   ///< shifted entries of theUCbound and theLCbound
+
+   /// returns the set recording the shifted entries of bound vector \p bound
+   ShiftSet& shiftSet(const VectorBase<R>& bound)
+   {
+      if(&bound == &theUBbound || &bound == &theLBbound)
+         return shiftedBasic;
+      else if(&bound == &theURbound || &bound == &theLRbound)
+         return shiftedRows;
+
+      assert(&bound == &theUCbound || &bound == &theLCbound);
+      return shiftedCols;
+   }
+
+   /// moves the shift records when the basic variable at position \p leaveIdx is replaced by \p enterId
+   void moveShifted(int leaveIdx, const SPxId& enterId);
    int            m_maxCycle;    ///< maximum steps before cycling is detected.
    int            m_numCycle;    ///< actual number of degenerate steps so far.
    bool           initialized;   ///< true, if all vectors are setup.
@@ -408,6 +471,7 @@ protected:
    int            enterCount;    ///< number of ENTER iterations
    int            primalCount;   ///< number of primal iterations
    int            polishCount;   ///< number of solution polishing iterations
+   int            polishAttempts; ///< number of candidates tried during solution polishing
 
    int            boundflips;          ///< number of performed bound flips
    int            totalboundflips;     ///< total number of bound flips
@@ -485,16 +549,25 @@ public:
    Timer*   multTimeFull;              ///< time spent in setupPupdate() ignoring sparsity
    Timer*   multTimeColwise;           ///< time spent in setupPupdate(), columnwise multiplication
    Timer*   multTimeUnsetup;           ///< time spent in setupPupdate() w/o sparsity information
+   Timer*   polishTime;                ///< time spent in solution polishing
+   Timer*   unShiftTime;               ///< time spent in unShift()
    int      multSparseCalls;           ///< number of products exploiting sparsity
    int      multFullCalls;             ///< number of products ignoring sparsity
    int      multColwiseCalls;          ///< number of products, columnwise multiplication
    int      multUnsetupCalls;          ///< number of products w/o sparsity information
+   int      shiftCount;                ///< number of bounds shifted
+   int      unShiftCount;              ///< number of calls to unShift()
+   int      cleanupStart;              ///< iteration of the first unShift() in an optimality check, -1 if none
 
    SPxOut* spxout;                     ///< message handler
 
    DataArray<int>
    integerVariables;    ///< supplementary variable information, 0: continous variable, 1: integer variable
 
+   SPxCheckpointWriter checkpointWriter;  ///< writes checkpoints of the solve in the background
+   SPxCheckpointData resumeData;          ///< checkpoint to resume the next solve from
+   bool     hasResumeData;             ///< should the next solve be resumed from resumeData?
+
    //-----------------------------
    void setOutstream(SPxOut& newOutstream)
    {
@@ -595,6 +668,9 @@ public:
 
    /// copy LP.
    virtual void loadLP(const SPxLPBase<R>& LP, bool initSlackBasis = true);
+   /// copy LP with a different number type, converting the values without an intermediate copy.
+   template <class S>
+   void loadLP(const SPxLPBase<S>& LP, bool initSlackBasis = true);
    /// setup linear solver to use. If \p destroy is true, \p slusolver will be freed in destructor.
    virtual void setBasisSolver(SLinSolver<R>* slu, const bool destroy = false);
    /// setup pricer to use. If \p destroy is true, \p pricer will be freed in destructor.
@@ -673,12 +749,25 @@ public:
     */
    void performSolutionPolishing();
 
+   /// tries to pivot the candidates into (ENTER) or out of (LEAVE) the basis until none of them succeeds anymore
+   /** Successfully pivoted candidates are removed from \p candidates.  In the entering case, the candidates are row
+    *  indices if \p rowCandidates is true and column indices otherwise; in the leaving case they are basis positions.
+    *  Returns the number of successful pivots.
+    */
+   int polishCandidates(DIdxSet& candidates, bool rowCandidates, bool& stop);
+
    /// set objective of solution polishing (0: off, 1: max_basic_slack, 2: min_basic_slack)
    void setSolutionPolishing(SolutionPolish _polishObj)
    {
       polishObj = _polishObj;
    }
 
+   /// set maximum number of candidates tried during solution polishing (-1: no limit)
+   void setSolutionPolishingLimit(int limit)
+   {
+      polishLimit = limit;
+   }
+
    /// return objective of solution polishing
    SolutionPolish getSolutionPolishing()
    {
@@ -870,6 +959,8 @@ public:
       multTimeFull = TimerFactory::switchTimer(multTimeFull, ttype);
       multTimeColwise = TimerFactory::switchTimer(multTimeColwise, ttype);
       multTimeUnsetup = TimerFactory::switchTimer(multTimeUnsetup, ttype);
+      polishTime = TimerFactory::switchTimer(polishTime, ttype);
+      unShiftTime = TimerFactory::switchTimer(unShiftTime, ttype);
       timerType = ttype;
    }
 
@@ -881,6 +972,8 @@ public:
       assert(timerType == multTimeFull->type());
       assert(timerType == multTimeColwise->type());
       assert(timerType == multTimeUnsetup->type());
+      assert(timerType == polishTime->type());
+      assert(timerType == unShiftTime->type());
       return timerType;
    }
 
@@ -1120,6 +1213,8 @@ public:
       changeElement(this->number(rid), this->number(cid), val, scale);
    }
    ///
+   virtual void changeElements(int n, const int rows[], const int cols[], const R vals[], bool scale = false);
+   ///
    virtual void changeSense(typename SPxLPBase<R>::SPxSense sns);
    ///@}
 
@@ -1634,6 +1729,7 @@ public:
       // use maximum to not count tightened bounds in case of equality shifts
       theShift += MAXIMUM(to - theUBbound[i], 0.0);
       theUBbound[i] = to;
+      markShifted(theUBbound, i);
    }
    /// shift \p i 'th \ref soplex::SPxSolver::lbBound "lbBound" to \p to.
    void shiftLBbound(int i, R to)
@@ -1642,6 +1738,7 @@ public:
       // use maximum to not count tightened bounds in case of equality shifts
       theShift += MAXIMUM(theLBbound[i] - to, 0.0);
       theLBbound[i] = to;
+      markShifted(theLBbound, i);
    }
    /// shift \p i 'th \ref soplex::SPxSolver::upBound "upBound" to \p to.
    void shiftUPbound(int i, R to)
@@ -1650,6 +1747,7 @@ public:
       // use maximum to not count tightened bounds in case of equality shifts
       theShift += MAXIMUM(to - (*theUbound)[i], 0.0);
       (*theUbound)[i] = to;
+      markShifted(*theUbound, i);
    }
    /// shift \p i 'th \ref soplex::SPxSolver::lpBound "lpBound" to \p to.
    void shiftLPbound(int i, R to)
@@ -1658,6 +1756,7 @@ public:
       // use maximum to not count tightened bounds in case of equality shifts
       theShift += MAXIMUM((*theLbound)[i] - to, 0.0);
       (*theLbound)[i] = to;
+      markShifted(*theLbound, i);
    }
    /// shift \p i 'th \ref soplex::SPxSolver::ucBound "ucBound" to \p to.
    void shiftUCbound(int i, R to)
@@ -1666,6 +1765,7 @@ public:
       // use maximum to not count tightened bounds in case of equality shifts
       theShift += MAXIMUM(to - (*theCoUbound)[i], 0.0);
       (*theCoUbound)[i] = to;
+      markShifted(*theCoUbound, i);
    }
    /// shift \p i 'th \ref soplex::SPxSolver::lcBound "lcBound" to \p to.
    void shiftLCbound(int i, R to)
@@ -1674,6 +1774,13 @@ public:
       // use maximum to not count tightened bounds in case of equality shifts
       theShift += MAXIMUM((*theCoLbound)[i] - to, 0.0);
       (*theCoLbound)[i] = to;
+      markShifted(*theCoLbound, i);
+   }
+   /// records that entry \p i of bound vector \p bound has been shifted
+   void markShifted(const VectorBase<R>& bound, int i)
+   {
+      ++shiftCount;
+      shiftSet(bound).add(i);
    }
    ///
    void testBounds() const;
@@ -1686,6 +1793,22 @@ public:
    /// remove shift as much as possible.
    virtual void unShift(void);
 
+   /// number of bounds shifted in the last call to solve().
+   int shifts() const
+   {
+      return shiftCount;
+   }
+   /// number of calls to unShift() in the last call to solve().
+   int unShifts() const
+   {
+      return unShiftCount;
+   }
+   /// number of iterations after the bounds were first unshifted for an optimality check in the last call to solve().
+   int cleanupIterations() const
+   {
+      return (cleanupStart < 0) ? 0 : iterations() - cleanupStart;
+   }
+
    /// get violation of constraints.
    virtual void qualConstraintViolation(R& maxviol, R& sumviol) const;
    /// get violations of bounds.
@@ -2079,6 +2202,15 @@ protected:
    typename SPxBasisBase<R>::Desc::Status varStatusToBasisStatusCol(int col, VarStatus stat)
    const;
 
+   /// hands the current basis and dual norms over to the checkpoint writer
+   void writeCheckpoint();
+
+   /// loads the basis of the checkpoint to resume from, if it matches the LP
+   void resumeCheckpointBasis();
+
+   /// loads the dual norms of the checkpoint to resume from, if they match the simplex type and representation
+   void resumeCheckpointNorms();
+
 public:
 
    /// gets basis status for a single row
@@ -2131,6 +2263,32 @@ public:
    /// set dual norms
    bool setDualNorms(int nnormsRow, int nnormsCol, R* norms);
 
+   /// writes checkpoints of the basis and the dual norms to \p filename every \p iterations iterations and every
+   /// \p seconds seconds of a solve; a null or empty \p filename disables checkpointing
+   void setCheckpoint(const char* filename, int iterations, Real seconds);
+
+   /// reads a checkpoint from \p filename, from which the next solve is resumed if it matches the LP
+   bool readCheckpoint(const char* filename);
+
+   /// sets checkpoint data, from which the next solve is resumed if it matches the LP
+   void setResumeData(const SPxCheckpointData& data)
+   {
+      resumeData = data;
+      hasResumeData = true;
+   }
+
+   /// name of the checkpoint file, empty if checkpointing is disabled
+   const char* checkpointFile() const
+   {
+      return checkpointWriter.fileName().c_str();
+   }
+
+   /// number of checkpoints written
+   int numCheckpoints() const
+   {
+      return checkpointWriter.numWritten();
+   }
+
    /// pass integrality information about the variables to the solver
    void setIntegralityInformation(int ncols, int* intInfo);
 
@@ -2195,6 +2353,12 @@ public:
       return polishCount;
    }
 
+   /// return number of candidates tried during solution polishing
+   int polishCandidatesTried()
+   {
+      return polishAttempts;
+   }
+
    /// time spent in last call to method solve().
    Real time() const
    {
@@ -97,6 +97,26 @@ void SPxSolverBase<R>::loadLP(const SPxLPBase<R>& lp, bool initSlackBasis)
    SPxBasisBase<R>::load(this, initSlackBasis);
 }
 
+template <class R>
+template <class S>
+void SPxSolverBase<R>::loadLP(const SPxLPBase<S>& lp, bool initSlackBasis)
+{
+   clear();
+   unInit();
+   this->unLoad();
+   resetClockStats();
+
+   if(thepricer)
+      thepricer->clear();
+
+   if(theratiotester)
+      theratiotester->clear();
+
+   SPxLPBase<R>::operator=(lp);
+   reDim();
+   SPxBasisBase<R>::load(this, initSlackBasis);
+}
+
 template <class R>
 void SPxSolverBase<R>::setBasisSolver(SLinSolver<R>* slu, const bool destroy)
 {
@@ -328,6 +348,9 @@ void SPxSolverBase<R>::setType(Type tp)
 
       theShift  = 0.0;
       lastShift = 0.0;
+      shiftedBasic.clear();
+      shiftedRows.clear();
+      shiftedCols.clear();
 
       if(type() == ENTER)
       {
@@ -450,6 +473,9 @@ void SPxSolverBase<R>::setType(Type tp)
       SPxBasisBase<R>::solve(*theFvec, *theFrhs);
 
       theShift = 0.0;
+      shiftedBasic.clear();
+      shiftedRows.clear();
+      shiftedCols.clear();
 
       if(type() == ENTER)
       {
@@ -1096,6 +1122,7 @@ void SPxSolverBase<R>::setType(Type tp)
       , thePricing(FULL)
       , theRep(p_rep)
       , polishObj(POLISH_OFF)
+      , polishLimit(-1)
       , theTime(nullptr)
       , timerType(ttype)
       , theCumulativeTime(0.0)
@@ -1160,7 +1187,11 @@ void SPxSolverBase<R>::setType(Type tp)
       , multFullCalls(0)
       , multColwiseCalls(0)
       , multUnsetupCalls(0)
+      , shiftCount(0)
+      , unShiftCount(0)
+      , cleanupStart(-1)
       , integerVariables(0)
+      , hasResumeData(false)
    {
       theTime = TimerFactory::createTimer(timerType);
 
@@ -1168,6 +1199,8 @@ void SPxSolverBase<R>::setType(Type tp)
       multTimeFull = TimerFactory::createTimer(timerType);
       multTimeColwise = TimerFactory::createTimer(timerType);
       multTimeUnsetup = TimerFactory::createTimer(timerType);
+      polishTime = TimerFactory::createTimer(timerType);
+      unShiftTime = TimerFactory::createTimer(timerType);
 
       setDelta(DEFAULT_BND_VIOL);
 
@@ -1209,16 +1242,22 @@ void SPxSolverBase<R>::setType(Type tp)
       assert(multTimeFull);
       assert(multTimeColwise);
       assert(multTimeUnsetup);
+      assert(polishTime);
+      assert(unShiftTime);
       theTime->~Timer();
       multTimeSparse->~Timer();
       multTimeFull->~Timer();
       multTimeColwise->~Timer();
       multTimeUnsetup->~Timer();
+      polishTime->~Timer();
+      unShiftTime->~Timer();
       spx_free(theTime);
       spx_free(multTimeSparse);
       spx_free(multTimeFull);
       spx_free(multTimeColwise);
       spx_free(multTimeUnsetup);
+      spx_free(polishTime);
+      spx_free(unShiftTime);
    }
 
 
@@ -1233,6 +1272,7 @@ void SPxSolverBase<R>::setType(Type tp)
          thePricing = base.thePricing;
          theRep = base.theRep;
          polishObj = base.polishObj;
+         polishLimit = base.polishLimit;
          timerType = base.timerType;
          maxIters = base.maxIters;
          maxTime = base.maxTime;
@@ -1249,6 +1289,9 @@ void SPxSolverBase<R>::setType(Type tp)
          m_leavetol = base.m_leavetol;
          theShift = base.theShift;
          lastShift = base.lastShift;
+         shiftedBasic = base.shiftedBasic;
+         shiftedRows = base.shiftedRows;
+         shiftedCols = base.shiftedCols;
          m_maxCycle = base.m_maxCycle;
          m_numCycle = base.m_numCycle;
          initialized = base.initialized;
@@ -1288,6 +1331,7 @@ void SPxSolverBase<R>::setType(Type tp)
          theCumulativeTime = base.theCumulativeTime;
          primalCount = base.primalCount;
          polishCount = base.polishCount;
+         polishAttempts = base.polishAttempts;
          boundflips = base.boundflips;
          totalboundflips = base.totalboundflips;
          enterCycles = base.enterCycles;
@@ -1318,8 +1362,14 @@ void SPxSolverBase<R>::setType(Type tp)
          multFullCalls = base.multFullCalls;
          multColwiseCalls = base.multColwiseCalls;
          multUnsetupCalls = base.multUnsetupCalls;
+         shiftCount = base.shiftCount;
+         unShiftCount = base.unShiftCount;
+         cleanupStart = base.cleanupStart;
          spxout = base.spxout;
          integerVariables = base.integerVariables;
+         checkpointWriter = base.checkpointWriter;
+         resumeData = base.resumeData;
+         hasResumeData = base.hasResumeData;
 
          if(base.theRep == COLUMN)
          {
@@ -1428,11 +1478,12 @@ void SPxSolverBase<R>::setType(Type tp)
    template <class R>
    SPxSolverBase<R>::SPxSolverBase(const SPxSolverBase<R>& base)
       : SPxLPBase<R> (base)
-      , SPxBasisBase<R>(this->basSe)
+      , SPxBasisBase<R>(base)
       , theType(base.theType)
       , thePricing(base.thePricing)
       , theRep(base.theRep)
       , polishObj(base.polishObj)
+      , polishLimit(base.polishLimit)
       , timerType(base.timerType)
       , theCumulativeTime(base.theCumulativeTime)
       , maxIters(base.maxIters)
@@ -1452,6 +1503,9 @@ void SPxSolverBase<R>::setType(Type tp)
       , m_leavetol(base.m_leavetol)
       , theShift(base.theShift)
       , lastShift(base.lastShift)
+      , shiftedBasic(base.shiftedBasic)
+      , shiftedRows(base.shiftedRows)
+      , shiftedCols(base.shiftedCols)
       , m_maxCycle(base.m_maxCycle)
       , m_numCycle(base.m_numCycle)
       , initialized(base.initialized)
@@ -1498,6 +1552,7 @@ void SPxSolverBase<R>::setType(Type tp)
       , enterCount(base.enterCount)
       , primalCount(base.primalCount)
       , polishCount(base.polishCount)
+      , polishAttempts(base.polishAttempts)
       , boundflips(base.boundflips)
       , totalboundflips(base.totalboundflips)
       , enterCycles(base.enterCycles)
@@ -1528,14 +1583,22 @@ void SPxSolverBase<R>::setType(Type tp)
       , multFullCalls(base.multFullCalls)
       , multColwiseCalls(base.multColwiseCalls)
       , multUnsetupCalls(base.multUnsetupCalls)
+      , shiftCount(base.shiftCount)
+      , unShiftCount(base.unShiftCount)
+      , cleanupStart(base.cleanupStart)
       , spxout(base.spxout)
       , integerVariables(base.integerVariables)
+      , checkpointWriter(base.checkpointWriter)
+      , resumeData(base.resumeData)
+      , hasResumeData(base.hasResumeData)
    {
       theTime = TimerFactory::createTimer(timerType);
       multTimeSparse = TimerFactory::createTimer(timerType);
       multTimeFull = TimerFactory::createTimer(timerType);
       multTimeColwise = TimerFactory::createTimer(timerType);
       multTimeUnsetup = TimerFactory::createTimer(timerType);
+      polishTime = TimerFactory::createTimer(timerType);
+      unShiftTime = TimerFactory::createTimer(timerType);
 
       if(base.theRep == COLUMN)
       {
@@ -2242,6 +2305,134 @@ void SPxSolverBase<R>::setType(Type tp)
       return true;
    }
 
+   template <class R>
+   void SPxSolverBase<R>::setCheckpoint(const char* filename, int iterations, Real seconds)
+   {
+      checkpointWriter.setup(filename == nullptr ? std::string() : std::string(filename), iterations,
+                             double(seconds));
+   }
+
+   template <class R>
+   bool SPxSolverBase<R>::readCheckpoint(const char* filename)
+   {
+      hasResumeData = resumeData.readFile(filename);
+      return hasResumeData;
+   }
+
+   template <class R>
+   void SPxSolverBase<R>::writeCheckpoint()
+   {
+      SPxCheckpointData data;
+
+      data.nRows = this->nRows();
+      data.nCols = this->nCols();
+      data.nNzos = this->nNzos();
+      data.type = int(type());
+      data.rep = int(rep());
+      data.iteration = this->iteration();
+
+      DataArray<VarStatus> rows(data.nRows);
+      DataArray<VarStatus> cols(data.nCols);
+      getBasis(rows.get_ptr(), cols.get_ptr(), data.nRows, data.nCols);
+
+      data.rowStatus.resize(data.nRows);
+      data.colStatus.resize(data.nCols);
+
+      for(int i = 0; i < data.nRows; ++i)
+         data.rowStatus[i] = static_cast<signed char>(rows[i]);
+
+      for(int i = 0; i < data.nCols; ++i)
+         data.colStatus[i] = static_cast<signed char>(cols[i]);
+
+      int nnormsRow;
+      int nnormsCol;
+      getNdualNorms(nnormsRow, nnormsCol);
+
+      std::vector<R> norms(size_t(nnormsRow) + size_t(nnormsCol));
+
+      if(!norms.empty() && getDualNorms(nnormsRow, nnormsCol, norms.data()))
+      {
+         data.nNormsRow = nnormsRow;
+         data.nNormsCol = nnormsCol;
+         data.norms.resize(norms.size());
+
+         for(size_t i = 0; i < norms.size(); ++i)
+            data.norms[i] = double(norms[i]);
+      }
+
+      checkpointWriter.write(std::move(data));
+
+      MSG_INFO3((*this->spxout), (*this->spxout) << " --- writing checkpoint at iteration " << this->iteration()
+                << " to <" << checkpointWriter.fileName() << ">" << std::endl;)
+   }
+
+   template <class R>
+   void SPxSolverBase<R>::resumeCheckpointBasis()
+   {
+      assert(hasResumeData);
+
+      if(resumeData.nRows != this->nRows() || resumeData.nCols != this->nCols()
+            || resumeData.nNzos != this->nNzos())
+      {
+         MSG_WARNING((*this->spxout), (*this->spxout) << "WSOLVE70 checkpoint does not match the LP and is ignored"
+                     << std::endl;)
+         hasResumeData = false;
+         return;
+      }
+
+      DataArray<VarStatus> rows(resumeData.nRows);
+      DataArray<VarStatus> cols(resumeData.nCols);
+
+      for(int i = 0; i < resumeData.nRows; ++i)
+         rows[i] = VarStatus(resumeData.rowStatus[i]);
+
+      for(int i = 0; i < resumeData.nCols; ++i)
+         cols[i] = VarStatus(resumeData.colStatus[i]);
+
+      if(!isBasisValid(rows, cols))
+      {
+         MSG_WARNING((*this->spxout), (*this->spxout) << "WSOLVE71 basis of the checkpoint is invalid and ignored"
+                     << std::endl;)
+         hasResumeData = false;
+         return;
+      }
+
+      setBasis(rows.get_const_ptr(), cols.get_const_ptr());
+
+      MSG_INFO1((*this->spxout), (*this->spxout) << " --- resuming from checkpoint taken at iteration "
+                << resumeData.iteration << std::endl;)
+   }
+
+   template <class R>
+   void SPxSolverBase<R>::resumeCheckpointNorms()
+   {
+      assert(hasResumeData);
+
+      // the norms refer to the simplex type and representation the checkpoint was taken with
+      bool matching = false;
+
+      if(resumeData.type == int(type()) && resumeData.rep == int(rep()))
+      {
+         if(type() == LEAVE && rep() == COLUMN)
+            matching = (resumeData.nNormsRow == dim() && resumeData.nNormsCol == 0);
+         else if(type() == ENTER && rep() == ROW)
+            matching = (resumeData.nNormsRow == coDim() && resumeData.nNormsCol == dim());
+      }
+
+      if(matching)
+      {
+         std::vector<R> norms(resumeData.norms.size());
+
+         for(size_t i = 0; i < norms.size(); ++i)
+            norms[i] = R(resumeData.norms[i]);
+
+         setDualNorms(resumeData.nNormsRow, resumeData.nNormsCol, norms.data());
+      }
+
+      hasResumeData = false;
+      resumeData = SPxCheckpointData();
+   }
+
    template <class R>
    void SPxSolverBase<R>::setIntegralityInformation(int ncols, int* intInfo)
    {
@@ -0,0 +1,208 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file  spxthreads.h
+ * @brief Minimal helpers for block-parallel loops.
+ *
+ * The helpers in this file split an index range into a fixed sequence of consecutive blocks and process the blocks
+ * on a number of worker threads.  The block partition only depends on the range and the block size, never on the
+ * number of threads, such that callers storing one partial result per block and combining them in block order obtain
+ * bit-identical results for every thread count.
+ */
+
+#ifndef _SPXTHREADS_H_
+#define _SPXTHREADS_H_
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "soplex/spxdefines.h"
+
+namespace soplex
+{
+
+/// default number of indices processed in one block by spxParallelFor()
+#define SOPLEX_PARALLEL_BLOCKSIZE 4096
+
+/// returns the number of blocks of size \p blocksize needed to cover \p n indices
+inline int spxNumBlocks(int n, int blocksize = SOPLEX_PARALLEL_BLOCKSIZE)
+{
+   assert(blocksize > 0);
+   return n <= 0 ? 0 : (n - 1) / blocksize + 1;
+}
+
+/// computes the index range [\p first, \p last) of block \p block when covering \p n indices with blocks of \p blocksize
+inline void spxBlockRange(int block, int n, int& first, int& last,
+                          int blocksize = SOPLEX_PARALLEL_BLOCKSIZE)
+{
+   assert(block >= 0);
+   assert(block < spxNumBlocks(n, blocksize));
+   first = block * blocksize;
+   last = std::min(n, first + blocksize);
+}
+
+/// calls \p func(b) for every block b = 0, ..., \p nblocks - 1 using at most \p nthreads threads
+/**
+ *  The calling thread participates in the work; if \p nthreads <= 1 or there is only a single block, everything is
+ *  executed sequentially without spawning threads.  The blocks are handed out dynamically, hence \p func must not
+ *  rely on the order in which blocks are processed.  Since the tolerances stored in Param are thread local, they are
+ *  passed on to the worker threads.  An exception thrown by \p func is rethrown in the calling thread after all
+ *  workers have finished.
+ */
+template <class F>
+void spxParallelFor(int nthreads, int nblocks, const F& func)
+{
+   if(nblocks <= 0)
+      return;
+
+   nthreads = std::min(nthreads, nblocks);
+
+   if(nthreads <= 1)
+   {
+      for(int b = 0; b < nblocks; ++b)
+         func(b);
+
+      return;
+   }
+
+   const Real eps = Param::epsilon();
+   const Real epsFactor = Param::epsilonFactorization();
+   const Real epsUpdate = Param::epsilonUpdate();
+   const Real epsPivot = Param::epsilonPivot();
+
+   std::atomic<int> nextBlock(0);
+   std::vector<std::exception_ptr> errors(nthreads);
+
+   auto work = [&](int t)
+   {
+      try
+      {
+         for(int b = nextBlock++; b < nblocks; b = nextBlock++)
+            func(b);
+      }
+      catch(...)
+      {
+         errors[t] = std::current_exception();
+         nextBlock = nblocks;
+      }
+   };
+
+   std::vector<std::thread> workers;
+   workers.reserve(nthreads - 1);
+
+   for(int t = 1; t < nthreads; ++t)
+   {
+      workers.emplace_back([&, t]()
+      {
+         Param::setEpsilon(eps);
+         Param::setEpsilonFactorization(epsFactor);
+         Param::setEpsilonUpdate(epsUpdate);
+         Param::setEpsilonPivot(epsPivot);
+         work(t);
+      });
+   }
+
+   work(0);
+
+   for(auto& worker : workers)
+      worker.join();
+
+   for(auto& error : errors)
+   {
+      if(error)
+         std::rethrow_exception(error);
+   }
+}
+
+/// calls \p func(first, last) for consecutive index ranges covering [0, \p n) using at most \p nthreads threads
+template <class F>
+void spxParallelForRange(int nthreads, int n, const F& func, int blocksize = SOPLEX_PARALLEL_BLOCKSIZE)
+{
+   spxParallelFor(nthreads, spxNumBlocks(n, blocksize), [&](int b)
+   {
+      int first;
+      int last;
+      spxBlockRange(b, n, first, last, blocksize);
+      func(first, last);
+   });
+}
+
+/// computes the maximum and the sum of violations over [0, \p n) using at most \p nthreads threads
+/**
+ *  \p func(first, last, maxviol, sumviol) must update \p maxviol and \p sumviol by the violations of the indices in
+ *  [first, last).  The partial results of the blocks are combined in block order, hence \p maxviol and \p sumviol are
+ *  bit-identical for every number of threads.
+ */
+template <class T, class F>
+void spxParallelViolation(int nthreads, int n, T& maxviol, T& sumviol, const F& func,
+                          int blocksize = SOPLEX_PARALLEL_BLOCKSIZE)
+{
+   int nblocks = spxNumBlocks(n, blocksize);
+   std::vector<T> blockmax(nblocks, T(0));
+   std::vector<T> blocksum(nblocks, T(0));
+
+   spxParallelFor(nthreads, nblocks, [&](int b)
+   {
+      int first;
+      int last;
+      spxBlockRange(b, n, first, last, blocksize);
+      func(first, last, blockmax[b], blocksum[b]);
+   });
+
+   maxviol = 0;
+   sumviol = 0;
+
+   for(int b = 0; b < nblocks; ++b)
+   {
+      if(blockmax[b] > maxviol)
+         maxviol = blockmax[b];
+
+      sumviol += blocksum[b];
+   }
+}
+
+/// sets \p dst[i] to \p src[i], converted to the value type of \p dst, for i = 0, ..., \p n - 1 using at most
+/// \p nthreads threads
+/**
+ *  Each entry is converted into its own destination object, such that number types allocating memory, like GMP
+ *  rationals, need no shared temporaries.
+ */
+template <class T, class S>
+void spxParallelConvert(int nthreads, int n, T& dst, const S& src)
+{
+   typedef typename std::remove_reference<decltype(dst[0])>::type Value;
+
+   spxParallelForRange(nthreads, n, [&](int first, int last)
+   {
+      for(int i = first; i < last; ++i)
+         dst[i] = Value(src[i]);
+   });
+}
+
+} // namespace soplex
+#endif // _SPXTHREADS_H_
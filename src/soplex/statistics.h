@@ -106,6 +106,10 @@ public:
    Timer* reconstructionTime; ///< time for rational reconstructions
    Timer::TYPE timerType; ///< type of timer (user or wallclock)
 
+   Real polishingTime; ///< time for solution polishing (included in simplex time)
+   Real unshiftTime; ///< time for removing bound shifts (included in simplex time)
+   Real barrierTime; ///< time for the interior point method including crossover (included in solving time)
+   Real crossoverTime; ///< time for crossover (included in barrier time)
    Real multTimeSparse; ///< time for computing A*x exploiting sparsity (setupPupdate(), PRICE step)
    Real multTimeFull; ///< time for computing A*x ignoring sparsity (setupPupdate(), PRICE step)
    Real multTimeColwise; ///< time for computing A*x columnwise (setupPupdate(), PRICE step)
@@ -123,7 +127,11 @@ public:
    int iterationsPrimal; ///< number of iterations with Primal
    int iterationsFromBasis; ///< number of iterations from Basis
    int iterationsPolish; ///< number of iterations during solution polishing
+   int iterationsBarrier; ///< number of interior point iterations
    int boundflips; ///< number of dual bound flips
+   int shifts; ///< number of bound shifts
+   int unshifts; ///< number of attempts to remove the bound shifts
+   int iterationsCleanup; ///< number of iterations after the bound shifts were first removed
    int luFactorizationsReal; ///< number of basis matrix factorizations in real precision
    int luSolvesReal; ///< number of (forward and backward) solves with basis matrix in real precision
    int luFactorizationsRational; ///< number of basis matrix factorizations in rational precision
@@ -133,6 +141,9 @@ public:
    int pivotRefinements; ///< number of refinement steps until final basis is reached
    int feasRefinements; ///< number of refinement steps during infeasibility test
    int unbdRefinements; ///< number of refinement steps during undboundedness test
+   size_t preprocessingMemory; ///< number of bytes of the constraint matrix before preprocessing
+   size_t preprocessingPeakMemory; ///< estimated peak number of bytes of matrix data during preprocessing
+   size_t lpCopyMemorySaved; ///< estimated number of bytes of matrix data of LP copies avoided during synchronization
 
    // Improved dual simplex statistics
    int callsReducedProb;      ///< number of times the reduced problem is solved. This includes the initial solve.
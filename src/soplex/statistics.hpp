@@ -78,6 +78,10 @@ typename SoPlexBase<R>::Statistics& SoPlexBase<R>::Statistics::operator=(const S
    multTimeFull = rhs.multTimeFull;
    multTimeColwise = rhs.multTimeColwise;
    multTimeUnsetup = rhs.multTimeUnsetup;
+   polishingTime = rhs.polishingTime;
+   unshiftTime = rhs.unshiftTime;
+   barrierTime = rhs.barrierTime;
+   crossoverTime = rhs.crossoverTime;
    multSparseCalls = rhs.multSparseCalls;
    multFullCalls = rhs.multFullCalls;
    multColwiseCalls = rhs.multColwiseCalls;
@@ -89,7 +93,12 @@ typename SoPlexBase<R>::Statistics& SoPlexBase<R>::Statistics::operator=(const S
    iterations = rhs.iterations;
    iterationsPrimal = rhs.iterationsPrimal;
    iterationsFromBasis = rhs.iterationsFromBasis;
+   iterationsPolish = rhs.iterationsPolish;
+   iterationsBarrier = rhs.iterationsBarrier;
    boundflips = rhs.boundflips;
+   shifts = rhs.shifts;
+   unshifts = rhs.unshifts;
+   iterationsCleanup = rhs.iterationsCleanup;
    luFactorizationsReal = rhs.luFactorizationsReal;
    luSolvesReal = rhs.luSolvesReal;
    luFactorizationsRational = rhs.luFactorizationsRational;
@@ -99,6 +108,9 @@ typename SoPlexBase<R>::Statistics& SoPlexBase<R>::Statistics::operator=(const S
    pivotRefinements = rhs.pivotRefinements;
    feasRefinements = rhs.feasRefinements;
    unbdRefinements = rhs.unbdRefinements;
+   preprocessingMemory = rhs.preprocessingMemory;
+   preprocessingPeakMemory = rhs.preprocessingPeakMemory;
+   lpCopyMemorySaved = rhs.lpCopyMemorySaved;
 
    return *this;
 }
@@ -138,7 +150,15 @@ void SoPlexBase<R>::Statistics::clearSolvingData()
    iterationsPrimal = 0;
    iterationsFromBasis = 0;
    iterationsPolish = 0;
+   polishingTime = 0;
+   unshiftTime = 0;
+   barrierTime = 0;
+   crossoverTime = 0;
+   iterationsBarrier = 0;
    boundflips = 0;
+   shifts = 0;
+   unshifts = 0;
+   iterationsCleanup = 0;
    luFactorizationsReal = 0;
    luSolvesReal = 0;
    luFactorizationsRational = 0;
@@ -148,6 +168,9 @@ void SoPlexBase<R>::Statistics::clearSolvingData()
    pivotRefinements = 0;
    feasRefinements = 0;
    unbdRefinements = 0;
+   preprocessingMemory = 0;
+   preprocessingPeakMemory = 0;
+   lpCopyMemorySaved = 0;
 
    callsReducedProb = 0;
    iterationsInit = 0;
@@ -179,7 +202,7 @@ void SoPlexBase<R>::Statistics::print(std::ostream& os)
    Real solTime = solvingTime->time();
    Real totTime = readingTime->time() + solTime;
    Real otherTime = solTime - syncTime->time() - transformTime->time() - preprocessingTime->time() -
-                    simplexTime->time() - rationalTime->time();
+                    simplexTime->time() - rationalTime->time() - barrierTime;
 
    R avgPrimalDegeneracy = iterationsPrimal > 0 ? sumPrimalDegen / iterationsPrimal : 0.0;
    R avgDualDegeneracy = (iterations - iterationsPrimal) > 0 ?
@@ -200,6 +223,35 @@ void SoPlexBase<R>::Statistics::print(std::ostream& os)
    if(solTime > 0)
       os << " (" << 100 * (simplexTime->time() / solTime) << "% of solving time)";
 
+   if(polishingTime > 0)
+   {
+      os << "\n    Polishing       : " << polishingTime;
+
+      if(solTime > 0)
+         os << " (" << 100 * (polishingTime / solTime) << "% of solving time)";
+   }
+
+   if(unshiftTime > 0)
+   {
+      os << "\n    Unshifting      : " << unshiftTime;
+
+      if(solTime > 0)
+         os << " (" << 100 * (unshiftTime / solTime) << "% of solving time)";
+   }
+
+   if(barrierTime > 0)
+   {
+      os << "\n  Barrier           : " << barrierTime;
+
+      if(solTime > 0)
+         os << " (" << 100 * (barrierTime / solTime) << "% of solving time)";
+
+      os << "\n    Crossover       : " << crossoverTime;
+
+      if(solTime > 0)
+         os << " (" << 100 * (crossoverTime / solTime) << "% of solving time)";
+   }
+
    os << "\n  Synchronization   : " << syncTime->time();
 
    if(solTime > 0)
@@ -220,6 +272,18 @@ void SoPlexBase<R>::Statistics::print(std::ostream& os)
    if(solTime > 0)
       os << " (" << 100 * otherTime / solTime << "% of solving time)";
 
+   if(preprocessingPeakMemory > 0)
+   {
+      os << "\nPreprocessing memory: " << preprocessingPeakMemory / 1048576.0 << " MB peak";
+
+      if(preprocessingMemory > 0)
+         os << " (" << 100 * double(preprocessingPeakMemory) / double(preprocessingMemory) <<
+            "% of original matrix)";
+   }
+
+   if(lpCopyMemorySaved > 0)
+      os << "\nLP copies avoided   : " << lpCopyMemorySaved / 1048576.0 << " MB of matrix data";
+
    os << "\nRefinements         : " << refinements << "\n"
       << "  Stalling          : " << stallRefinements << "\n"
       << "  Pivoting          : " << pivotRefinements << "\n"
@@ -249,6 +313,16 @@ void SoPlexBase<R>::Statistics::print(std::ostream& os)
 
    os << "\n  Bound flips       : " << boundflips;
    os << "\n  Sol. polishing    : " << iterationsPolish;
+   os << "\n  Cleanup           : " << iterationsCleanup;
+
+   if(iterations > 0)
+      os << " (" << 100 * double(iterationsCleanup) / double(iterations) << "%)";
+
+   if(iterationsBarrier > 0)
+      os << "\nBarrier iterations  : " << iterationsBarrier;
+
+   os << "\nBound shifts        : " << shifts << "\n"
+      << "  Unshifts          : " << unshifts;
 
    os << "\nLU factorizations   : " << luFactorizationsReal << "\n"
       << "  Factor. frequency : ";
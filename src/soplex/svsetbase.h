@@ -36,6 +36,7 @@
 #endif
 
 #include <assert.h>
+#include <chrono>
 
 #include "soplex/spxdefines.h"
 #include "soplex/svectorbase.h"
@@ -44,9 +45,52 @@
 #include "soplex/classset.h"
 #include "soplex/datakey.h"
 #include "soplex/idlist.h"
+#include "soplex/spxthreads.h"
 
 namespace soplex
 {
+/// Statistics of the compaction of the nonzero memory of an SVSetBase.
+struct SVSetMemStats
+{
+   int fullPacks;           ///< number of compactions of the whole nonzero memory
+   long long packSteps;     ///< number of incremental compaction steps
+   long long movedNzos;     ///< number of nonzeros moved by compactions
+   double packTime;         ///< total time spent in compactions in seconds
+   double maxPackTime;      ///< maximum time of a single compaction or compaction step in seconds
+   int unusedMem;           ///< estimated unused nonzero memory between and at the end of the vectors
+   int memSize;             ///< used nonzero memory including unused memory between the vectors
+
+   SVSetMemStats()
+      : fullPacks(0)
+      , packSteps(0)
+      , movedNzos(0)
+      , packTime(0.0)
+      , maxPackTime(0.0)
+      , unusedMem(0)
+      , memSize(0)
+   {}
+
+   /// fraction of the used nonzero memory that is unused
+   double fragmentation() const
+   {
+      return memSize > 0 ? double(unusedMem) / double(memSize) : 0.0;
+   }
+
+   /// accumulates the statistics of another set
+   SVSetMemStats& operator+=(const SVSetMemStats& rhs)
+   {
+      fullPacks += rhs.fullPacks;
+      packSteps += rhs.packSteps;
+      movedNzos += rhs.movedNzos;
+      packTime += rhs.packTime;
+      maxPackTime = (rhs.maxPackTime > maxPackTime) ? rhs.maxPackTime : maxPackTime;
+      unusedMem += rhs.unusedMem;
+      memSize += rhs.memSize;
+
+      return *this;
+   }
+};
+
 /**@brief   Sparse vector set.
  * @ingroup Algebra
  *
@@ -67,6 +111,11 @@ namespace soplex
  *   provided for getting the DataKey to a SVectorBase or its number and vice versa.  Further, each add() method for
  *   enlarging an SVSetBase is provided with two signatures. One of them returns the DataKey%s assigned to the
  *   SVectorBase%s added to the SVSetBase.
+ *
+ *   Removing or enlarging SVectorBase%s leaves unused nonzero memory between the vectors, which is reclaimed by
+ *   memPack() once the nonzero memory is exhausted.  Since memPack() moves all nonzeros at once, an incremental
+ *   compaction can be enabled by setMemPackSlice(): then every request for nonzero memory moves at most a slice of
+ *   nonzeros towards the front, as soon as the unused memory exceeds half of the amount that triggers memPack().
  */
 template < class R >
 class SVSetBase : protected ClassArray < Nonzero<R> >
@@ -174,6 +223,8 @@ private:
    IdList < DLPSV > list;  ///< doubly linked list for non-zero management
    int unusedMem;  ///< an estimate of the unused memory (the difference of max() and size() summed up over all vectors) due to deleteVec() and xtend()
    int numUnusedMemUpdates;  ///< counter for how often unusedMem has been updated since last exact value
+   DLPSV* packCursor;        ///< next vector to be moved by memPackStep(), or 0 if no incremental compaction is running
+   SVSetMemStats packStats;  ///< statistics of the compaction of the nonzero memory
 
    ///@}
 
@@ -182,6 +233,7 @@ private:
    ///@{
 
    double factor;          ///< sparse vector memory enlargment factor
+   int packSlice;          ///< maximum number of nonzeros moved by one incremental compaction step, 0 for none
 
    ///@}
 
@@ -209,6 +261,17 @@ private:
 #endif
    }
 
+   /// adds the time since \p start to the compaction statistics
+   void updatePackTime(const std::chrono::steady_clock::time_point& start)
+   {
+      double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      packStats.packTime += time;
+
+      if(time > packStats.maxPackTime)
+         packStats.maxPackTime = time;
+   }
+
    /// update estimation of unused memory
    void updateUnusedMemEstimation(int change)
    {
@@ -233,6 +296,14 @@ private:
    /// Provides enough nonzero memory for \p n more Nonzero%s.
    void ensureMem(int n, bool shortenLast = true)
    {
+      // the incremental compaction starts at half of the unused memory that triggers memPack() and moves nonzeros in
+      // proportion to the requested memory such that it completes before the unused memory doubles
+      if(packSlice > 0 && (packCursor != 0 || unusedMem > 0.5 * (SVSetBaseArray::memFactor - 1.0) * memMax()))
+      {
+         double rate = 2.0 / (SVSetBaseArray::memFactor - 1.0);
+         memPackStep(int(MINIMUM(double(packSlice), rate * (n + 1))));
+      }
+
       if(memSize() + n <= memMax())
          return;
 
@@ -259,8 +330,10 @@ private:
       int missingMem = (memSize() + n - memMax());
 
       ///@todo use an independent parameter "memwastefactor" here
+      // while an incremental compaction is running, the memory is enlarged instead, unless the slices are too small to
+      // keep up with the unused memory
       if(missingMem > 0 && missingMem <= unusedMem
-            && unusedMem > (SVSetBaseArray::memFactor - 1.0) * memMax())
+            && unusedMem > (packCursor == 0 ? 1.0 : 2.0) * (SVSetBaseArray::memFactor - 1.0) * memMax())
          memPack();
 
       // if the unused memory was overestimated and packing did not help, we need to reallocate
@@ -278,6 +351,9 @@ private:
    /// Deleting a vector from the data array and the list.
    void deleteVec(DLPSV* ps)
    {
+      if(ps == packCursor)
+         packCursor = list.next(ps);
+
       /* delete last entries */
       if(ps == list.last())
       {
@@ -574,6 +650,9 @@ public:
 #endif
             updateUnusedMemEstimation(ps->size());
 
+            if(ps == packCursor)
+               packCursor = list.next(ps);
+
             list.remove(ps);
             list.append(ps);
 
@@ -723,6 +802,37 @@ public:
       remove(perm);
    }
 
+   /// Replaces the %set by the SVectorBase%s of \p pset, converting their nonzeros on up to \p threads threads.
+   /** The vectors are created one after the other in the nonzero memory first, such that their nonzeros can be
+    *  converted independently over blocks of vectors.
+    */
+   template < class S >
+   void assign(const SVSetBase<S>& pset, int threads)
+   {
+      if(this == (const SVSetBase<R>*)(&pset))
+         return;
+
+      clear(pset.size());
+
+      const int n = pset.num();
+      int len = 0;
+
+      for(int i = 0; i < n; ++i)
+         len += pset[i].size();
+
+      ensurePSVec(n);
+      ensureMem(len);
+
+      for(int i = 0; i < n; ++i)
+         create(pset[i].size());
+
+      spxParallelForRange(threads, n, [&](int first, int last)
+      {
+         for(int i = first; i < last; ++i)
+            static_cast< SVectorBase<R>& >(set[i]) = pset[i];
+      });
+   }
+
    /// Removes all SVectorBase%s from %set.
    void clear(int minNewSize = -1)
    {
@@ -743,6 +853,7 @@ public:
       list.clear();
       unusedMem = 0;
       numUnusedMemUpdates = 0;
+      packCursor = 0;
    }
 
    ///@}
@@ -912,6 +1023,8 @@ public:
       int used;
       int j;
 
+      auto start = std::chrono::steady_clock::now();
+
       for(used = 0, ps = list.first(); ps; ps = list.next(ps))
       {
          const int sz = ps->size();
@@ -947,6 +1060,129 @@ public:
 
       unusedMem = 0;
       numUnusedMemUpdates = 0;
+      packCursor = 0;
+
+      packStats.fullPacks++;
+      packStats.movedNzos += used;
+      updatePackTime(start);
+   }
+
+   /// Incremental garbage collection in nonzero memory.
+   /** Moves the nonzeros of the vectors following the last vector moved by the previous call towards the front, until
+    *  about \p budget nonzeros have been moved, where each vector counts at least one.  The unused memory between the
+    *  vectors passed is collected behind the last vector moved, and returned to the end of the nonzero memory when the
+    *  last vector is reached.
+    *
+    *  @return true if the compaction reached the last vector; the next call starts again from the first vector
+    */
+   bool memPackStep(int budget)
+   {
+      if(list.first() == 0)
+      {
+         packCursor = 0;
+         return true;
+      }
+
+      auto start = std::chrono::steady_clock::now();
+
+      if(packCursor == 0)
+         packCursor = list.first();
+
+      DLPSV* ps = packCursor;
+      long long moved = 0;
+
+      while(ps != 0 && budget > 0)
+      {
+         DLPSV* prev = (ps == list.first()) ? 0 : ps->prev();
+         Nonzero<R>* newmem = SVSetBaseArray::get_ptr();
+
+         if(prev != 0)
+         {
+            prev->set_max(prev->size());
+            newmem = prev->mem() + prev->size();
+         }
+
+         const int sz = ps->size();
+         Nonzero<R>* end = ps->mem() + ps->max();
+
+         if(ps->mem() != newmem)
+         {
+            assert(newmem < ps->mem());
+
+            // cannot use memcpy, because the memory might overlap
+            for(int j = 0; j < sz; ++j)
+               newmem[j] = ps->mem()[j];
+
+            moved += sz;
+            budget -= sz;
+         }
+
+         budget--;
+
+         if(ps == list.last())
+         {
+            // keep the unused memory of the last vector and return the collected memory to the end of the nonzero memory
+            int collected = int(end - (newmem + ps->max()));
+
+            ps->setMem(ps->max(), newmem);
+            ps->set_size(sz);
+
+            if(collected > 0)
+            {
+               SVSetBaseArray::removeLast(collected);
+               updateUnusedMemEstimation(-collected);
+            }
+
+            ps = 0;
+         }
+         else
+         {
+            ps->setMem(int(end - newmem), newmem);
+            ps->set_size(sz);
+            ps = list.next(ps);
+         }
+      }
+
+      packCursor = ps;
+
+      packStats.packSteps++;
+      packStats.movedNzos += moved;
+      updatePackTime(start);
+
+      return packCursor == 0;
+   }
+
+   /// Sets the maximum number of nonzeros moved by one incremental compaction step; 0 disables incremental compaction.
+   void setMemPackSlice(int slice)
+   {
+      assert(slice >= 0);
+      packSlice = slice;
+
+      if(packSlice == 0)
+         packCursor = 0;
+   }
+
+   /// Returns the maximum number of nonzeros moved by one incremental compaction step.
+   int memPackSlice() const
+   {
+      return packSlice;
+   }
+
+   /// Returns the statistics of the compaction of the nonzero memory.
+   SVSetMemStats memStats() const
+   {
+      SVSetMemStats stats = packStats;
+
+      stats.unusedMem = unusedMem;
+      stats.memSize = memSize();
+
+      return stats;
+   }
+
+   /// Resets the statistics of the compaction of the nonzero memory.
+   void resetMemStats()
+   {
+      packStats = SVSetMemStats();
    }
 
    ///@}
@@ -958,7 +1194,12 @@ public:
    /// Resets maximum number of SVectorBase%s.
    void reMax(int newmax = 0)
    {
-      list.move(set.reMax(newmax));
+      ptrdiff_t delta = set.reMax(newmax);
+
+      list.move(delta);
+
+      if(packCursor != 0)
+         packCursor = reinterpret_cast<DLPSV*>(reinterpret_cast<char*>(packCursor) + delta);
    }
 
    /// Consistency check.
@@ -1001,7 +1242,9 @@ public:
       , set((pmax > 0) ? pmax : 8)
       , unusedMem(0)
       , numUnusedMemUpdates(0)
+      , packCursor(0)
       , factor(pfac)
+      , packSlice(0)
    {
       assert(isConsistent());
    }
@@ -1067,7 +1310,9 @@ public:
       : SVSetBaseArray()
       , unusedMem(old.unusedMem)
       , numUnusedMemUpdates(old.numUnusedMemUpdates)
+      , packCursor(0)
       , factor(old.factor)
+      , packSlice(old.packSlice)
    {
       *this = old;
 
@@ -1080,7 +1325,9 @@ public:
       : SVSetBaseArray()
       , unusedMem(old.unusedMem)
       , numUnusedMemUpdates(old.numUnusedMemUpdates)
+      , packCursor(0)
       , factor(old.factor)
+      , packSlice(old.packSlice)
    {
       *this = old;
 
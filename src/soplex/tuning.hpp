@@ -0,0 +1,302 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the class library                   */
+/*       SoPlex --- the Sequential object-oriented simPlex.                  */
+/*                                                                           */
+/*  Copyright 1996-2022 Zuse Institute Berlin                                */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SoPlex; see the file LICENSE. If not email to soplex@zib.de.  */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <assert.h>
+
+#include "soplex/spxdefines.h"
+#include "soplex.h"
+#include "soplex/spxthreads.h"
+
+#define TUNING_IMPROVEMENT  0.99  /**< factor by which a configuration must reduce the total time to be accepted */
+#define TUNING_MAXROUNDS    3     /**< maximum number of rounds over all tuned parameters */
+
+/* This file contains the local parameter tuning
+ *
+ * The tuning performs a coordinate search starting from the current parameters: in every round, each tuned parameter
+ * is set to each of its candidate values in turn, all LPs are solved with all candidates in parallel, and the value
+ * with the smallest total solving time is kept if it improves on the best configuration by at least one percent.  The
+ * search stops after a round without improvement, after TUNING_MAXROUNDS rounds, or when the time budget is used up.
+ * Every LP is stopped after twice its solving time with the initial configuration plus one second, such that poor
+ * candidates do not use up the budget; unsolved LPs count with twice this time limit. */
+
+namespace soplex
+{
+
+/// sets all parameters except the verbosity to their values in newSettings
+template <class R>
+void SoPlexBase<R>::_changeParams(const Settings& newSettings)
+{
+   for(int i = 0; i < SoPlexBase<R>::BOOLPARAM_COUNT; ++i)
+   {
+      if(newSettings._boolParamValues[i] != boolParam(BoolParam(i)))
+         setBoolParam(BoolParam(i), newSettings._boolParamValues[i]);
+   }
+
+   for(int i = 0; i < SoPlexBase<R>::INTPARAM_COUNT; ++i)
+   {
+      if(i != SoPlexBase<R>::VERBOSITY && newSettings._intParamValues[i] != intParam(IntParam(i)))
+         setIntParam(IntParam(i), newSettings._intParamValues[i]);
+   }
+
+   for(int i = 0; i < SoPlexBase<R>::REALPARAM_COUNT; ++i)
+   {
+      if(newSettings._realParamValues[i] != realParam(RealParam(i)))
+         setRealParam(RealParam(i), newSettings._realParamValues[i]);
+   }
+}
+
+
+
+/// solves every LP with every configuration in parallel and stores the wall-clock solving times
+template <class R>
+void SoPlexBase<R>::_tuningRuns(const std::vector<std::string>& filenames, const std::vector<Settings>& configs,
+                                const std::vector<Real>& timeLimits, std::vector<Real>& times)
+{
+   const int nfiles = int(filenames.size());
+   const int nruns = nfiles * int(configs.size());
+
+   assert(int(timeLimits.size()) == nfiles);
+
+   times.assign(nruns, -1.0);
+
+   spxParallelFor(intParam(SoPlexBase<R>::THREADS), nruns, [&](int run)
+   {
+      const int i = run % nfiles;
+      SoPlexBase<R> lpsolver;
+
+      lpsolver.setIntParam(SoPlexBase<R>::VERBOSITY, SPxOut::ERROR);
+      lpsolver._changeParams(configs[run / nfiles]);
+      lpsolver.setIntParam(SoPlexBase<R>::THREADS, 1);
+      lpsolver.setIntParam(SoPlexBase<R>::TIMER, TIMER_WALLCLOCK);
+      lpsolver.setTimings(Timer::WALLCLOCK_TIME);
+      lpsolver.setRealParam(SoPlexBase<R>::TIMELIMIT, MINIMUM(timeLimits[i], realParam(SoPlexBase<R>::TIMELIMIT)));
+
+      if(!lpsolver.readFile(filenames[i].c_str()))
+         return;
+
+      const typename SPxSolverBase<R>::Status status = lpsolver.optimize();
+
+      if(status == SPxSolverBase<R>::OPTIMAL || status == SPxSolverBase<R>::INFEASIBLE
+            || status == SPxSolverBase<R>::UNBOUNDED || status == SPxSolverBase<R>::INForUNBD)
+         times[run] = lpsolver.solveTime();
+      else
+         times[run] = 2.0 * lpsolver.realParam(SoPlexBase<R>::TIMELIMIT);
+   });
+}
+
+
+
+/// searches the tuned parameters for the configuration with the smallest total solving time
+template <class R>
+bool SoPlexBase<R>::tuneSettings(const std::vector<std::string>& filenames, Real timeBudget, Real& speedup)
+{
+   // a tuned parameter is an integer or real parameter with its candidate values
+   struct TunedParam
+   {
+      bool isInt;
+      int param;
+      std::vector<Real> values;
+   };
+
+   const std::vector<TunedParam> tunedParams =
+   {
+      { true, PRICER, { PRICER_AUTO, PRICER_DEVEX, PRICER_QUICKSTEEP, PRICER_STEEP } },
+      { true, RATIOTESTER, { RATIOTESTER_HARRIS, RATIOTESTER_FAST, RATIOTESTER_BOUNDFLIPPING, RATIOTESTER_PACKED } },
+      { true, SCALER, { SCALER_OFF, SCALER_UNIEQUI, SCALER_BIEQUI, SCALER_GEO1, SCALER_GEO8, SCALER_LEASTSQ, SCALER_GEOEQUI } },
+      { true, SIMPLIFIER, { SIMPLIFIER_OFF, SIMPLIFIER_INTERNAL, SIMPLIFIER_PAPILO } },
+      { true, REPRESENTATION, { REPRESENTATION_AUTO, REPRESENTATION_COLUMN, REPRESENTATION_ROW } },
+      { true, FACTOR_UPDATE_MAX, { 0, 50, 100, 200 } },
+      { false, REFAC_UPDATE_FILL, { 2.0, 5.0, 10.0 } }
+   };
+
+   const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   auto elapsed = [&start]()
+   {
+      return std::chrono::duration<Real>(std::chrono::steady_clock::now() - start).count();
+   };
+
+   // sums the times of one configuration over the LPs
+   auto totalTime = [](const std::vector<Real>& times, size_t first, size_t n)
+   {
+      Real sum = 0.0;
+
+      for(size_t i = first; i < first + n; ++i)
+         sum += times[i];
+
+      return sum;
+   };
+
+   // the search starts from the current parameters, where the automatic selection is turned off since it would
+   // override the tuned parameters
+   std::vector<Settings> configs(1, *_currentSettings);
+   configs[0]._boolParamValues[SoPlexBase<R>::AUTOSELECT] = false;
+
+   std::vector<std::string> lpfiles;
+   std::vector<Real> timeLimits(filenames.size(), timeBudget);
+   std::vector<Real> times;
+
+   MSG_INFO1(spxout, spxout << "Tuning parameters on " << filenames.size() << " LPs with " <<
+             intParam(SoPlexBase<R>::THREADS) << " threads and a time budget of " << timeBudget << " seconds . . .\n\n");
+
+   _tuningRuns(filenames, configs, timeLimits, times);
+
+   for(size_t i = 0; i < filenames.size(); ++i)
+   {
+      if(times[i] < 0.0)
+      {
+         MSG_WARNING(spxout, spxout << "Could not read LP file <" << filenames[i] << "> - skipping\n");
+      }
+      else
+         lpfiles.push_back(filenames[i]);
+   }
+
+   if(lpfiles.empty())
+      return false;
+
+   const size_t nfiles = lpfiles.size();
+   std::vector<Real> initialTimes;
+
+   for(size_t i = 0; i < filenames.size(); ++i)
+   {
+      if(times[i] >= 0.0)
+         initialTimes.push_back(times[i]);
+   }
+
+   timeLimits.resize(nfiles);
+
+   for(size_t i = 0; i < nfiles; ++i)
+      timeLimits[i] = 2.0 * initialTimes[i] + 1.0;
+
+   Settings best = configs[0];
+   std::vector<Real> bestTimes = initialTimes;
+   const Real initialTotal = totalTime(initialTimes, 0, nfiles);
+   Real bestTotal = initialTotal;
+
+   MSG_INFO1(spxout, spxout << std::fixed << std::setprecision(3) << "initial configuration: " << initialTotal <<
+             " seconds\n");
+
+   bool improved = true;
+
+   for(int round = 0; round < TUNING_MAXROUNDS && improved && elapsed() < timeBudget; ++round)
+   {
+      improved = false;
+
+      for(const TunedParam& tuned : tunedParams)
+      {
+         if(elapsed() >= timeBudget)
+            break;
+
+         const std::string& name = tuned.isInt ? _currentSettings->intParam.name[tuned.param] :
+                                   _currentSettings->realParam.name[tuned.param];
+
+         // collect the candidate values that differ from the best configuration and are supported by this build
+         configs.clear();
+
+         for(Real value : tuned.values)
+         {
+            Settings candidate = best;
+            SoPlexBase<R> probe;
+            probe.setIntParam(SoPlexBase<R>::VERBOSITY, SPxOut::ERROR);
+
+            if(tuned.isInt)
+            {
+               if(candidate._intParamValues[tuned.param] == int(value)
+                     || !probe.setIntParam(IntParam(tuned.param), int(value)))
+                  continue;
+
+               candidate._intParamValues[tuned.param] = int(value);
+            }
+            else
+            {
+               if(candidate._realParamValues[tuned.param] == value)
+                  continue;
+
+               candidate._realParamValues[tuned.param] = value;
+            }
+
+            configs.push_back(candidate);
+         }
+
+         if(configs.empty())
+            continue;
+
+         _tuningRuns(lpfiles, configs, timeLimits, times);
+
+         MSG_INFO1(spxout, spxout << "round " << round + 1 << ", " << std::setw(18) << std::left << name << std::right);
+
+         int bestConfig = -1;
+
+         for(int c = 0; c < int(configs.size()); ++c)
+         {
+            const Real total = totalTime(times, c * nfiles, nfiles);
+            const Real value = tuned.isInt ? Real(configs[c]._intParamValues[tuned.param]) :
+                               configs[c]._realParamValues[tuned.param];
+
+            MSG_INFO1(spxout, spxout << " | " << std::setprecision(0) << value << ": " << std::setprecision(3) << total);
+
+            if(total < TUNING_IMPROVEMENT * bestTotal)
+            {
+               bestTotal = total;
+               bestConfig = c;
+            }
+         }
+
+         MSG_INFO1(spxout, spxout << "\n");
+
+         if(bestConfig >= 0)
+         {
+            best = configs[bestConfig];
+            bestTimes.assign(times.begin() + bestConfig * nfiles, times.begin() + (bestConfig + 1) * nfiles);
+            improved = true;
+         }
+      }
+   }
+
+   speedup = initialTotal / MAXIMUM(bestTotal, Real(1e-6));
+
+   MSG_INFO1(spxout, spxout << "\n" << std::setw(24) << std::left << "LP" << std::right << " | " << std::setw(9) <<
+             "initial" << " | " << std::setw(9) << "tuned" << "\n");
+
+   for(size_t i = 0; i < nfiles; ++i)
+   {
+      MSG_INFO1(spxout, spxout << std::setw(24) << std::left
+                << lpfiles[i].substr(lpfiles[i].find_last_of('/') == std::string::npos ? 0 : lpfiles[i].find_last_of('/') + 1)
+                << std::right << " | " << std::setw(9) << initialTimes[i] << " | " << std::setw(9) << bestTimes[i] << "\n");
+   }
+
+   MSG_INFO1(spxout, spxout << "\ntotal time " << initialTotal << " seconds initially, " << bestTotal <<
+             " seconds tuned, speedup " << std::setprecision(2) << speedup << " after " << std::setprecision(1) <<
+             elapsed() << " seconds of tuning\n\n" << std::defaultfloat);
+
+   _changeParams(best);
+
+   return true;
+}
+
+} // namespace soplex
@@ -244,6 +244,43 @@ void SoPlex_getDualReal(void* soplex, double* dual, int dim)
    so->getDualReal(dual, dim);
 }
 
+/** gets the ranges of the objective coefficients and of the active sides in which the optimal basis stays optimal;
+ *  returns 1 on success and 0 otherwise
+ **/
+int SoPlex_getRangingReal(
+   void* soplex,
+   double* objlower,
+   double* objupper,
+   int ncols,
+   double* sidelower,
+   double* sideupper,
+   int nrows
+)
+{
+   SoPlex* so = (SoPlex*)(soplex);
+   VectorReal objlowervec(ncols);
+   VectorReal objuppervec(ncols);
+   VectorReal sidelowervec(nrows);
+   VectorReal sideuppervec(nrows);
+
+   if(!so->getRangingReal(objlowervec, objuppervec, sidelowervec, sideuppervec))
+      return 0;
+
+   for(int i = 0; i < so->numCols(); ++i)
+   {
+      objlower[i] = objlowervec[i];
+      objupper[i] = objuppervec[i];
+   }
+
+   for(int i = 0; i < so->numRows(); ++i)
+   {
+      sidelower[i] = sidelowervec[i];
+      sideupper[i] = sideuppervec[i];
+   }
+
+   return 1;
+}
+
 /** optimizes the given LP **/
 int SoPlex_optimize(void* soplex)
 {
@@ -87,6 +87,19 @@ char* SoPlex_getPrimalRationalString(void* soplex, int dim);
 /** gets dual solution **/
 void SoPlex_getDualReal(void* soplex, double* dual, int dim);
 
+/** gets the ranges of the objective coefficients and of the active sides in which the optimal basis stays optimal;
+ *  returns 1 on success and 0 otherwise
+ **/
+int SoPlex_getRangingReal(
+   void* soplex,
+   double* objlower,
+   double* objupper,
+   int ncols,
+   double* sidelower,
+   double* sideupper,
+   int nrows
+);
+
 /** optimizes the given LP **/
 int SoPlex_optimize(void* soplex);
 
@@ -30,9 +30,18 @@
 #include <math.h>
 #include <string.h>
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <io.h>
+#else
+#include <dirent.h>
+#endif
 
 #include "soplex.h"
 #include "soplex/validation.h"
@@ -50,12 +59,20 @@ void printUsage(const char* const argv[], int idx)
       "general options:\n"
       "  --readbas=<basfile>    read starting basis from file\n"
       "  --writebas=<basfile>   write terminal basis to file\n"
+      "  --readwarm=<file>      read starting basis and dual norms from binary warm-start file\n"
+      "  --writewarm=<file>     write terminal basis and dual norms to binary warm-start file\n"
+      "  --checkpoint=<file>    periodically write basis and dual norms to file during the solve\n"
+      "  --resume=<file>        resume the solve from a checkpoint file\n"
       "  --writefile=<lpfile>   write LP to file in LP or MPS format depending on extension\n"
       "  --writedual=<lpfile>   write the dual LP to a file in LP or MPS formal depending on extension\n"
       "  --<type>:<name>=<val>  change parameter value using syntax of settings file entries\n"
       "  --loadset=<setfile>    load parameters from settings file (overruled by command line parameters)\n"
       "  --saveset=<setfile>    save parameters to settings file\n"
       "  --diffset=<setfile>    save modified parameters to settings file\n"
+      "  --calibrate=<file>     learn the thresholds of the automatic selection (bool:autoselect) from timings on the\n"
+      "                         LP files listed in <file>, one per line; combine with --saveset to store them\n"
+      "  --tune=<dir>           tune parameters on the LP files in <dir> and save the best ones (default: tuned.set)\n"
+      "  --tunetime=<s>         time budget of parameter tuning in seconds (default: 600)\n"
       "  --extsol=<value>       external solution for soplex to use for validation\n"
       "\n"
       "limits and tolerances:\n"
@@ -78,7 +95,7 @@ void printUsage(const char* const argv[], int idx)
       "  -s<value>              choose simplifier/presolver (0 - off, 1* - internal, 2*- PaPILO)\n"
       "  -g<value>              choose scaling (0 - off, 1 - uni-equilibrium, 2* - bi-equilibrium, 3 - geometric, 4 - iterated geometric, 5 - least squares, 6 - geometric-equilibrium)\n"
       "  -p<value>              choose pricing (0* - auto, 1 - dantzig, 2 - parmult, 3 - devex, 4 - quicksteep, 5 - steep)\n"
-      "  -r<value>              choose ratio tester (0 - textbook, 1 - harris, 2 - fast, 3* - boundflipping)\n"
+      "  -r<value>              choose ratio tester (0 - textbook, 1 - harris, 2 - fast, 3* - boundflipping, 4 - packed harris)\n"
       "\n"
       "display options:\n"
       "  -v<level>              set verbosity to <level> (0 - error, 3 - normal, 5 - high)\n"
@@ -86,6 +103,7 @@ void printUsage(const char* const argv[], int idx)
       "  -y                     print dual multipliers\n"
       "  -X                     print primal solution in rational numbers\n"
       "  -Y                     print dual multipliers in rational numbers\n"
+      "  --ranging              print ranges of objective coefficients and sides in which the basis stays optimal\n"
       "  -q                     display detailed statistics\n"
       "  -c                     perform final check of optimal solution in original problem\n"
       "\n";
@@ -139,6 +157,58 @@ void freeStrings(char*& s1, char*& s2, char*& s3, char*& s4, char*& s5)
    }
 }
 
+// collects the names of the LP files (.mps, .lp, possibly gzipped) in a directory; returns false if it cannot be read
+static
+bool listLPFiles(const char* dirname, std::vector<std::string>& filenames)
+{
+   std::vector<std::string> entries;
+
+#if defined(_WIN32) || defined(_WIN64)
+   struct _finddata_t entry;
+   intptr_t handle = _findfirst((std::string(dirname) + "\\*").c_str(), &entry);
+
+   if(handle == -1)
+      return false;
+
+   do
+      entries.push_back(entry.name);
+
+   while(_findnext(handle, &entry) == 0);
+
+   _findclose(handle);
+#else
+   DIR* dir = opendir(dirname);
+
+   if(dir == nullptr)
+      return false;
+
+   for(struct dirent* entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+      entries.push_back(entry->d_name);
+
+   closedir(dir);
+#endif
+
+   const char* extensions[] = { ".mps", ".lp", ".mps.gz", ".lp.gz" };
+
+   for(const std::string& name : entries)
+   {
+      for(const char* ext : extensions)
+      {
+         const size_t len = strlen(ext);
+
+         if(name.size() > len && name.compare(name.size() - len, len, ext) == 0)
+         {
+            filenames.push_back(std::string(dirname) + "/" + name);
+            break;
+         }
+      }
+   }
+
+   std::sort(filenames.begin(), filenames.end());
+
+   return true;
+}
+
 /// performs external feasibility check with real type
 ///@todo implement external check; currently we use the internal methods for convenience
 
@@ -505,6 +575,49 @@ void printDualSolution(SoPlexBase<R>& soplex, NameSet& colnames, NameSet& rownam
       }
 }
 
+template <class R>
+static
+void printRanging(SoPlexBase<R>& soplex, NameSet& colnames, NameSet& rownames)
+{
+   int printprec;
+   int printwidth;
+   printprec = (int) - log10(Real(Param::epsilon()));
+   printwidth = printprec + 10;
+
+   VectorBase<R> objlower(soplex.numCols());
+   VectorBase<R> objupper(soplex.numCols());
+   VectorBase<R> sidelower(soplex.numRows());
+   VectorBase<R> sideupper(soplex.numRows());
+
+   if(!soplex.getRangingReal(objlower, objupper, sidelower, sideupper))
+   {
+      MSG_INFO1(soplex.spxout, soplex.spxout << "No ranging information available.\n")
+      return;
+   }
+
+   MSG_INFO1(soplex.spxout, soplex.spxout << "\nObjective ranging (name, lower, upper):\n";)
+
+   for(int i = 0; i < soplex.numCols(); ++i)
+   {
+      MSG_INFO1(soplex.spxout, soplex.spxout << colnames[i] << "\t"
+                << std::setw(printwidth) << std::setprecision(printprec)
+                << objlower[i] << "\t"
+                << std::setw(printwidth) << std::setprecision(printprec)
+                << objupper[i] << std::endl;)
+   }
+
+   MSG_INFO1(soplex.spxout, soplex.spxout << "\nSide ranging (name, lower, upper):\n";)
+
+   for(int i = 0; i < soplex.numRows(); ++i)
+   {
+      MSG_INFO1(soplex.spxout, soplex.spxout << rownames[i] << "\t"
+                << std::setw(printwidth) << std::setprecision(printprec)
+                << sidelower[i] << "\t"
+                << std::setw(printwidth) << std::setprecision(printprec)
+                << sideupper[i] << std::endl;)
+   }
+}
+
 // Runs SoPlex with the parsed boost variables map
 template <class R>
 int runSoPlex(int argc, char* argv[])
@@ -518,15 +631,23 @@ int runSoPlex(int argc, char* argv[])
    const char* lpfilename = nullptr;
    char* readbasname = nullptr;
    char* writebasname = nullptr;
+   char* readwarmname = nullptr;
+   char* writewarmname = nullptr;
+   char* checkpointname = nullptr;
+   char* resumename = nullptr;
    char* writefilename = nullptr;
    char* writedualfilename = nullptr;
    char* loadsetname = nullptr;
    char* savesetname = nullptr;
    char* diffsetname = nullptr;
+   char* calibratename = nullptr;
+   char* tunename = nullptr;
+   Real tuneTime = 600.0;
    bool printPrimal = false;
    bool printPrimalRational = false;
    bool printDual = false;
    bool printDualRational = false;
+   bool printRangingInfo = false;
    bool displayStatistics = false;
    bool checkSol = false;
 
@@ -607,6 +728,46 @@ int runSoPlex(int argc, char* argv[])
                   spxSnprintf(writebasname, strlen(filename) + 1, "%s", filename);
                }
             }
+            // --readwarm=<file> : read starting basis and dual norms from binary warm-start file
+            else if(strncmp(option, "readwarm=", 9) == 0)
+            {
+               if(readwarmname == nullptr)
+               {
+                  char* filename = &option[9];
+                  readwarmname = new char[strlen(filename) + 1];
+                  spxSnprintf(readwarmname, strlen(filename) + 1, "%s", filename);
+               }
+            }
+            // --writewarm=<file> : write terminal basis and dual norms to binary warm-start file
+            else if(strncmp(option, "writewarm=", 10) == 0)
+            {
+               if(writewarmname == nullptr)
+               {
+                  char* filename = &option[10];
+                  writewarmname = new char[strlen(filename) + 1];
+                  spxSnprintf(writewarmname, strlen(filename) + 1, "%s", filename);
+               }
+            }
+            // --checkpoint=<file> : periodically write checkpoints to file
+            else if(strncmp(option, "checkpoint=", 11) == 0)
+            {
+               if(checkpointname == nullptr)
+               {
+                  char* filename = &option[11];
+                  checkpointname = new char[strlen(filename) + 1];
+                  spxSnprintf(checkpointname, strlen(filename) + 1, "%s", filename);
+               }
+            }
+            // --resume=<file> : resume from checkpoint file
+            else if(strncmp(option, "resume=", 7) == 0)
+            {
+               if(resumename == nullptr)
+               {
+                  char* filename = &option[7];
+                  resumename = new char[strlen(filename) + 1];
+                  spxSnprintf(resumename, strlen(filename) + 1, "%s", filename);
+               }
+            }
             // --writefile=<lpfile> : write LP to file
             else if(strncmp(option, "writefile=", 10) == 0)
             {
@@ -669,6 +830,38 @@ int runSoPlex(int argc, char* argv[])
                   spxSnprintf(diffsetname, strlen(filename) + 1, "%s", filename);
                }
             }
+            // --calibrate=<file> : learn the thresholds of the automatic selection from the LP files listed in <file>
+            else if(strncmp(option, "calibrate=", 10) == 0)
+            {
+               if(calibratename == nullptr)
+               {
+                  char* filename = &option[10];
+                  calibratename = new char[strlen(filename) + 1];
+                  spxSnprintf(calibratename, strlen(filename) + 1, "%s", filename);
+               }
+            }
+            // --tune=<dir> : tune parameters on the LP files in <dir>
+            else if(strncmp(option, "tune=", 5) == 0)
+            {
+               if(tunename == nullptr)
+               {
+                  char* dirname = &option[5];
+                  tunename = new char[strlen(dirname) + 1];
+                  spxSnprintf(tunename, strlen(dirname) + 1, "%s", dirname);
+               }
+            }
+            // --tunetime=<s> : time budget of parameter tuning in seconds
+            else if(strncmp(option, "tunetime=", 9) == 0)
+            {
+               tuneTime = atof(&option[9]);
+
+               if(tuneTime <= 0.0)
+               {
+                  printUsage(argv, optidx);
+                  returnValue = 1;
+                  goto TERMINATE_FREESTRINGS;
+               }
+            }
             // --readmode=<value> : choose reading mode for <lpfile> (0* - floating-point, 1 - rational)
             else if(strncmp(option, "readmode=", 9) == 0)
             {
@@ -708,6 +901,11 @@ int runSoPlex(int argc, char* argv[])
                   goto TERMINATE_FREESTRINGS;
                }
             }
+            // --ranging : print ranges of objective coefficients and sides
+            else if(strcmp(option, "ranging") == 0)
+            {
+               printRangingInfo = true;
+            }
             // --arithmetic=<value> : base arithmetic type, directly handled in main()
             else if(strncmp(option, "arithmetic=", 11) == 0)
             {
@@ -827,7 +1025,7 @@ int runSoPlex(int argc, char* argv[])
 
          case 'r' :
 
-            // -r<value> : choose ratio tester (0 - textbook, 1 - harris, 2* - fast, 3 - boundflipping)
+            // -r<value> : choose ratio tester (0 - textbook, 1 - harris, 2* - fast, 3 - boundflipping, 4 - packed harris)
             if(!soplex->setIntParam(soplex->RATIOTESTER, option[2] - '0'))
             {
                printUsage(argv, optidx);
@@ -901,8 +1099,9 @@ int runSoPlex(int argc, char* argv[])
 
       MSG_INFO1(soplex->spxout, soplex->printUserSettings();)
 
-      // no LP file was given and no settings files are written
-      if(lpfilename == nullptr && savesetname == nullptr && diffsetname == nullptr)
+      // no LP file was given, no settings files are written and no calibration or tuning is performed
+      if(lpfilename == nullptr && savesetname == nullptr && diffsetname == nullptr && calibratename == nullptr
+            && tunename == nullptr)
       {
          printUsage(argv, 0);
          returnValue = 1;
@@ -918,6 +1117,51 @@ int runSoPlex(int argc, char* argv[])
          goto TERMINATE_FREESTRINGS;
       }
 
+      // learn the thresholds of the automatic selection
+      if(calibratename != nullptr)
+      {
+         std::ifstream listfile(calibratename);
+         std::vector<std::string> filenames;
+         std::string line;
+
+         while(std::getline(listfile, line))
+         {
+            line.erase(0, line.find_first_not_of(" \t"));
+            line.erase(line.find_last_not_of(" \t\r") + 1);
+
+            if(!line.empty() && line[0] != '#')
+               filenames.push_back(line);
+         }
+
+         if(!listfile.eof() || !soplex->calibrateAutoSelect(filenames))
+         {
+            MSG_ERROR(std::cerr << "Error calibrating the automatic selection on the LP files listed in <" << calibratename
+                      << ">\n");
+            returnValue = 1;
+            goto TERMINATE_FREESTRINGS;
+         }
+      }
+
+      // tune parameters and save the best ones
+      if(tunename != nullptr)
+      {
+         std::vector<std::string> filenames;
+         Real speedup;
+
+         if(!listLPFiles(tunename, filenames) || !soplex->tuneSettings(filenames, tuneTime, speedup))
+         {
+            MSG_ERROR(std::cerr << "Error tuning parameters on the LP files in <" << tunename << ">\n");
+            returnValue = 1;
+            goto TERMINATE_FREESTRINGS;
+         }
+
+         if(savesetname == nullptr)
+         {
+            savesetname = new char[strlen("tuned.set") + 1];
+            spxSnprintf(savesetname, strlen("tuned.set") + 1, "%s", "tuned.set");
+         }
+      }
+
       // save settings files
       if(savesetname != nullptr)
       {
@@ -944,7 +1188,8 @@ int runSoPlex(int argc, char* argv[])
       // no LP file given: exit after saving settings
       if(lpfilename == nullptr)
       {
-         if(loadsetname != nullptr || savesetname != nullptr || diffsetname != nullptr)
+         if(loadsetname != nullptr || savesetname != nullptr || diffsetname != nullptr || calibratename != nullptr
+               || tunename != nullptr)
          {
             MSG_INFO1(soplex->spxout, soplex->spxout << "\n");
          }
@@ -1019,6 +1264,36 @@ int runSoPlex(int argc, char* argv[])
          }
       }
 
+      // read warm-start file if specified
+      if(readwarmname != nullptr)
+      {
+         MSG_INFO1(soplex->spxout, soplex->spxout << "Reading warm-start file <" << readwarmname << "> . . . \n");
+
+         if(!soplex->readWarmStartFile(readwarmname))
+         {
+            MSG_ERROR(std::cerr << "Error while reading file <" << readwarmname << ">.\n");
+            returnValue = 1;
+            goto TERMINATE_FREESTRINGS;
+         }
+      }
+
+      // read checkpoint if specified
+      if(resumename != nullptr)
+      {
+         MSG_INFO1(soplex->spxout, soplex->spxout << "Reading checkpoint <" << resumename << "> . . . \n");
+
+         if(!soplex->readCheckpoint(resumename))
+         {
+            MSG_ERROR(std::cerr << "Error while reading checkpoint <" << resumename << ">.\n");
+            returnValue = 1;
+            goto TERMINATE_FREESTRINGS;
+         }
+      }
+
+      // write checkpoints if specified
+      if(checkpointname != nullptr)
+         soplex->setCheckpointFile(checkpointname);
+
       readingTime->stop();
 
       MSG_INFO1(soplex->spxout,
@@ -1038,6 +1313,9 @@ int runSoPlex(int argc, char* argv[])
       printPrimalSolution(*soplex, colnames, rownames, printPrimal, printPrimalRational);
       printDualSolution(*soplex, colnames, rownames, printDual, printDualRational);
 
+      if(printRangingInfo)
+         printRanging(*soplex, colnames, rownames);
+
       if(checkSol)
          checkSolution<R>(*soplex); // The type needs to get fixed here
 
@@ -1070,6 +1348,27 @@ int runSoPlex(int argc, char* argv[])
                       ">.\n\n");
          }
       }
+
+      // write warm-start file if specified
+      if(writewarmname != nullptr)
+      {
+         if(!soplex->hasBasis())
+         {
+            MSG_WARNING(soplex->spxout, soplex->spxout <<
+                        "No basis information available.  Could not write file <" << writewarmname << ">\n\n");
+         }
+         else if(!soplex->writeWarmStartFile(writewarmname))
+         {
+            MSG_ERROR(std::cerr << "Error while writing file <" << writewarmname << ">.\n\n");
+            returnValue = 1;
+            goto TERMINATE_FREESTRINGS;
+         }
+         else
+         {
+            MSG_INFO1(soplex->spxout, soplex->spxout << "Written warm-start information to file <" << writewarmname <<
+                      ">.\n\n");
+         }
+      }
    }
    catch(const SPxException& x)
    {
@@ -1080,6 +1379,12 @@ int runSoPlex(int argc, char* argv[])
 
 TERMINATE_FREESTRINGS:
    freeStrings(readbasname, writebasname, loadsetname, savesetname, diffsetname);
+   delete [] readwarmname;
+   delete [] writewarmname;
+   delete [] checkpointname;
+   delete [] resumename;
+   delete [] calibratename;
+   delete [] tunename;
 
 TERMINATE:
 